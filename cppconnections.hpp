@@ -1,6 +1,6 @@
 /**
  * @file cppconnections.hpp
- * @version 1.1.0
+ * @version 1.2.0
  * @brief A minimal signal-slot style callback system for C++.
  * @note This library is NOT thread safe and should not be used in a threaded setting!
  *
@@ -49,6 +49,167 @@
 #define CPP_CONNECTIONS_MAX_CONNECTIONS 128
 #endif
 
+#ifndef CPP_CONNECTIONS_MAX_QUEUED_EVENTS
+ /**
+  * @brief Defines how many buffered events a single `event_log` can hold.
+  * @since 1.2.0
+  *
+  * Event logs back deferred dispatch and are stored inline, so every log reserves
+  * room for this many copies of its signal's argument list. Only the `accumulate`
+  * coalescing policy ever uses more than one entry.
+  */
+#define CPP_CONNECTIONS_MAX_QUEUED_EVENTS 16
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_FORWARD_SIGNALS
+ /**
+  * @brief Defines how many distinct signals a single forwarding walk can track.
+  * @since 1.2.0
+  *
+  * Bounds the explicit stack used by flattened forwarding in `fire()` and by the
+  * cycle check in `forward_to()`. A forwarding graph reaching more signals than this
+  * is rejected by `forward_to()`, since it can no longer be proven to be acyclic.
+  */
+#define CPP_CONNECTIONS_MAX_FORWARD_SIGNALS 32
+#endif
+
+#ifndef CPP_CONNECTIONS_FORWARD_DEDUPE_SLOTS
+ /**
+  * @brief Defines the size of the hash set used to deduplicate subscribers during flattened forwarding.
+  * @since 1.2.0
+  *
+  * Must be a power of two. The set lives on the stack of `fire()` only while a flattened
+  * forwarding walk is in progress. Once it is full, further subscribers are no longer deduplicated.
+  */
+#define CPP_CONNECTIONS_FORWARD_DEDUPE_SLOTS 256
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_PLAN_ENTRIES
+ /**
+  * @brief Defines how many (callback, context) pairs a single `dispatch_plan` can hold.
+  * @since 1.2.0
+  *
+  * A frozen signal whose flattened forwarding graph reaches more subscribers than this
+  * cannot be compiled and keeps using the regular dispatch path of `fire()`.
+  */
+#define CPP_CONNECTIONS_MAX_PLAN_ENTRIES 256
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_KEYS
+ /**
+  * @brief Defines how many distinct keys a single `keyed_signal` can have subscribers for.
+  * @since 1.2.0
+  *
+  * Must be a power of two. It sizes the inline open-addressing hash table that maps
+  * keys to their subscriber lists.
+  */
+#define CPP_CONNECTIONS_MAX_KEYS 64
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_TOPICS
+ /**
+  * @brief Defines how many concrete topics a single `topic_bus` can intern.
+  * @since 1.2.0
+  *
+  * Must be a power of two. Each interned topic caches the patterns matching it.
+  */
+#define CPP_CONNECTIONS_MAX_TOPICS 64
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_PATTERNS
+ /**
+  * @brief Defines how many distinct subscription patterns a single `topic_bus` can hold.
+  * @since 1.2.0
+  *
+  * Every pattern owns a full `signal`, so this value multiplies the bus's memory usage.
+  * It must not exceed 255.
+  */
+#define CPP_CONNECTIONS_MAX_PATTERNS 32
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_TRIE_NODES
+ /**
+  * @brief Defines how many pattern segments the subscription trie of a `topic_bus` can hold.
+  * @since 1.2.0
+  */
+#define CPP_CONNECTIONS_MAX_TRIE_NODES 128
+#endif
+
+#ifndef CPP_CONNECTIONS_TOPIC_CHARACTERS
+ /**
+  * @brief Defines how many characters of topic names and pattern segments a `topic_bus` can store.
+  * @since 1.2.0
+  */
+#define CPP_CONNECTIONS_TOPIC_CHARACTERS 2048
+#endif
+
+#ifndef CPP_CONNECTIONS_POOL_SLAB_SIGNALS
+ /**
+  * @brief Defines how many signals each slab of a `signal_pool` holds.
+  * @since 1.2.0
+  *
+  * Larger slabs mean fewer allocations; when backing a pool with huge pages, pick a value
+  * so that `signal_pool::slab_bytes()` fills whole pages.
+  */
+#define CPP_CONNECTIONS_POOL_SLAB_SIGNALS 64
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_ONE_SHOTS
+ /**
+  * @brief Defines how many one-shot connections a `signal` keeps in its dedicated one-shot ring.
+  * @since 1.2.0
+  *
+  * `signal::once()` uses the ring for default-priority connections and falls back to
+  * the regular connection table once it is full. Must be at least 1.
+  */
+#define CPP_CONNECTIONS_MAX_ONE_SHOTS 32
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_CONNECTION_LINKS
+ /**
+  * @brief Defines how many link records are reserved statically, and how many more are allocated at a time.
+  * @since 1.2.0
+  *
+  * Connections keep the state used by `trackable`, `connection_group` and
+  * `connection::set_tags()` in a record taken from a pool shared by all signals,
+  * so the connection tables of signals that never use these features stay small.
+  * A connection holds a record from its first use of one of them until it is disconnected.
+  * Once the static records are all in use, the pool grows by blocks of this many records
+  * from the global `operator new`; blocks are kept for reuse, never returned. Must be at least 2.
+  */
+#define CPP_CONNECTIONS_MAX_CONNECTION_LINKS 4096
+#endif
+
+#ifndef CPP_CONNECTIONS_MAX_TIMERS
+ /**
+  * @brief Defines how many timers a single `timer_wheel` can have pending.
+  * @since 1.2.0
+  */
+#define CPP_CONNECTIONS_MAX_TIMERS 256
+#endif
+
+#ifndef CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES
+ /**
+  * @brief Defines how many bytes of inline storage each timer of a `timer_wheel` has.
+  * @since 1.2.0
+  *
+  * Signals keep the bookkeeping of their timed operations there, so the wheel never allocates.
+  * Scheduled fires (see `signal::fire_after()`) also store their arguments there, which
+  * leaves 64 bytes for the arguments with the default value.
+  */
+#define CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES 128
+#endif
+
+/*
+ * Bulk connection queries compare packed pointer arrays with AVX2 or SSE2 when the compiler
+ * targets them. Define CPP_CONNECTIONS_NO_SIMD to always use the portable scalar loops.
+ */
+#if !defined(CPP_CONNECTIONS_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#elif !defined(CPP_CONNECTIONS_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace connections {
     /**
      * @brief Custom implementation of move to not rely on the C++ standard library.
@@ -76,6 +237,565 @@ namespace connections {
         return static_cast<T&&>(t);
     }
 
+    /**
+     * @brief Internal helpers that are not part of the public interface.
+     * @since 1.2.0
+     *
+     * These utilities replace the small pieces of the C++ standard library the
+     * signal types need (type traits, index sequences and a tuple-like argument store),
+     * so the header stays free of standard library includes.
+     */
+    namespace detail {
+        template<typename T> struct remove_reference { typedef T type; };
+        template<typename T> struct remove_reference<T&> { typedef T type; };
+        template<typename T> struct remove_reference<T&&> { typedef T type; };
+
+        template<typename T> struct remove_const { typedef T type; };
+        template<typename T> struct remove_const<const T> { typedef T type; };
+
+        /**
+         * @brief Yields the by-value type used to store an argument of type `T`.
+         * @since 1.2.0
+         *
+         * References and top-level `const` are stripped so a stored argument owns
+         * its value and can be re-assigned when a buffered event is overwritten.
+         */
+        template<typename T>
+        struct stored {
+            typedef typename remove_const<typename remove_reference<T>::type>::type type;
+        };
+
+        template<unsigned int... indices>
+        struct index_list {};
+
+        template<unsigned int count, unsigned int... indices>
+        struct make_index_list : make_index_list<count - 1, count - 1, indices...> {};
+
+        template<unsigned int... indices>
+        struct make_index_list<0, indices...> {
+            typedef index_list<indices...> type;
+        };
+
+        template<unsigned int index, typename T>
+        struct pack_element {
+            typename stored<T>::type value;
+        };
+
+        template<typename indices, typename... types>
+        struct pack_storage;
+
+        template<unsigned int... indices, typename... types>
+        struct pack_storage<index_list<indices...>, types...> : pack_element<indices, types>... {
+            void store(types... args) {
+                int expand[] = { 0, ((void)(static_cast<pack_element<indices, types>&>(*this).value = move(args)), 0)... };
+                (void)expand;
+            }
+
+            template<typename target_type>
+            void fire_into(target_type& target) {
+                target.fire(static_cast<pack_element<indices, types>&>(*this).value...);
+            }
+        };
+
+        /**
+         * @brief Owns one copy of a signal's argument list so the event can be dispatched later.
+         * @since 1.2.0
+         *
+         * Every argument is stored by value (see `stored`), which requires the
+         * decayed argument types to be default constructible and copy assignable.
+         *
+         * @tparam arguments The argument types of the signal the pack belongs to.
+         */
+        template<typename... arguments>
+        struct argument_pack : pack_storage<typename make_index_list<sizeof...(arguments)>::type, arguments...> {};
+
+        /**
+         * @brief Unsigned integer type wide enough to hold an object size or a pointer value.
+         * @since 1.2.0
+         */
+        typedef decltype(sizeof(0)) size_type;
+
+        /**
+         * @brief Tag selecting the library's own placement allocation function.
+         * @since 1.2.0
+         *
+         * The standard placement form lives in `<new>`, which this header does not include.
+         */
+        struct placement_tag {};
+
+        /**
+         * @brief Source of the revision numbers of all signals with the given arguments.
+         * @since 1.2.0
+         *
+         * Whenever the topology of a signal changes in a way a compiled `dispatch_plan` depends
+         * on, the signal takes the next number from this counter. Numbers are never handed out
+         * twice, so a plan that remembers the revisions of the signals it was compiled from
+         * notices any change to them, even if a signal was replaced by another at the same address.
+         *
+         * @tparam arguments The argument types of the signals sharing this counter.
+         */
+        template<typename... arguments>
+        struct topology {
+            static unsigned long revision;
+        };
+
+        template<typename... arguments>
+        unsigned long topology<arguments...>::revision = 0;
+
+        /**
+         * @brief Collects the indices of the entries of `values` equal to `first` or `second`.
+         * @since 1.2.0
+         *
+         * `T` is a data or function pointer type. With AVX2 or SSE2 available, four or two
+         * 64-bit pointers (eight or four 32-bit ones) are compared per instruction and matches
+         * are read out of a bit mask; the remaining entries are compared one at a time.
+         *
+         * @param values Array of `count` pointers to search.
+         * @param count Number of entries in `values`.
+         * @param first A pointer to look for.
+         * @param second Another pointer to look for, which may equal `first`.
+         * @param matches Receives the ascending indices of matching entries; needs room for `count`.
+         * @return Number of indices written to `matches`.
+         */
+        template<typename T>
+        int match_pointers(const T* values, int count, T first, T second, int* matches) {
+            int found = 0;
+            int i = 0;
+
+#if !defined(CPP_CONNECTIONS_NO_SIMD) && (defined(__AVX2__) || defined(__SSE2__))
+            size_type first_bits = reinterpret_cast<size_type>(first);
+            size_type second_bits = reinterpret_cast<size_type>(second);
+            auto collect = [&](int mask, int lanes) {
+                for (int lane = 0; lane < lanes; ++lane) {
+                    if (mask & (1 << lane)) {
+                        matches[found++] = i + lane;
+                    }
+                }
+            };
+
+#if defined(__AVX2__)
+            if (sizeof(T) == 8) {
+                __m256i a = _mm256_set1_epi64x(static_cast<long long>(first_bits));
+                __m256i b = _mm256_set1_epi64x(static_cast<long long>(second_bits));
+                for (; i + 4 <= count; i += 4) {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+                    __m256i equal = _mm256_or_si256(_mm256_cmpeq_epi64(v, a), _mm256_cmpeq_epi64(v, b));
+                    collect(_mm256_movemask_pd(_mm256_castsi256_pd(equal)), 4);
+                }
+            } else if (sizeof(T) == 4) {
+                __m256i a = _mm256_set1_epi32(static_cast<int>(first_bits));
+                __m256i b = _mm256_set1_epi32(static_cast<int>(second_bits));
+                for (; i + 8 <= count; i += 8) {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+                    __m256i equal = _mm256_or_si256(_mm256_cmpeq_epi32(v, a), _mm256_cmpeq_epi32(v, b));
+                    collect(_mm256_movemask_ps(_mm256_castsi256_ps(equal)), 8);
+                }
+            }
+#else
+            if (sizeof(T) == 8) {
+                // SSE2 has no 64-bit compare: both 32-bit halves of a lane must be equal.
+                __m128i a = _mm_set1_epi64x(static_cast<long long>(first_bits));
+                __m128i b = _mm_set1_epi64x(static_cast<long long>(second_bits));
+                for (; i + 2 <= count; i += 2) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+                    __m128i equal_a = _mm_cmpeq_epi32(v, a);
+                    __m128i equal_b = _mm_cmpeq_epi32(v, b);
+                    equal_a = _mm_and_si128(equal_a, _mm_shuffle_epi32(equal_a, 0xB1));
+                    equal_b = _mm_and_si128(equal_b, _mm_shuffle_epi32(equal_b, 0xB1));
+                    collect(_mm_movemask_pd(_mm_castsi128_pd(_mm_or_si128(equal_a, equal_b))), 2);
+                }
+            } else if (sizeof(T) == 4) {
+                __m128i a = _mm_set1_epi32(static_cast<int>(first_bits));
+                __m128i b = _mm_set1_epi32(static_cast<int>(second_bits));
+                for (; i + 4 <= count; i += 4) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+                    __m128i equal = _mm_or_si128(_mm_cmpeq_epi32(v, a), _mm_cmpeq_epi32(v, b));
+                    collect(_mm_movemask_ps(_mm_castsi128_ps(equal)), 4);
+                }
+            }
+#endif
+#endif
+
+            for (; i < count; ++i) {
+                if (values[i] == first || values[i] == second) {
+                    matches[found++] = i;
+                }
+            }
+            return found;
+        }
+
+        /**
+         * @brief Intrusive list link tying a connection to the `trackable` it was tracked by.
+         * @since 1.2.0
+         *
+         * The link does not depend on the connection's argument types, so one `trackable`
+         * can hold connections of any signal type. It is part of a circular list whose
+         * sentinel is stored in the trackable; `previous` is null while not tracked.
+         */
+        struct track_link {
+            track_link* previous;
+            track_link* next;
+
+            /**
+             * @brief The connection holding this link.
+             * @since 1.2.0
+             */
+            void* subject;
+
+            /**
+             * @brief Disconnects `subject`, which also unlinks this link.
+             * @since 1.2.0
+             */
+            void (*sever)(void* subject);
+        };
+
+        inline void unlink(track_link& link) {
+            link.previous->next = link.next;
+            link.next->previous = link.previous;
+            link.previous = nullptr;
+            link.next = nullptr;
+        }
+
+        /**
+         * @brief Inserts `link` right behind `existing` in the list `existing` is in, with the same `sever` function.
+         * @since 1.2.0
+         */
+        inline void link_after(track_link& existing, track_link& link, void* subject) {
+            link.subject = subject;
+            link.sever = existing.sever;
+            link.previous = &existing;
+            link.next = existing.next;
+            existing.next->previous = &link;
+            existing.next = &link;
+        }
+
+        /**
+         * @brief Circular list of `track_link`s, shared by `trackable` and `connection_group`.
+         * @since 1.2.0
+         */
+        class link_list {
+        public:
+            link_list() {
+                head.previous = &head;
+                head.next = &head;
+            }
+
+            link_list(const link_list&) = delete;
+            link_list& operator=(const link_list&) = delete;
+
+            /**
+             * @brief Adds a link at the front, moving it out of any list it is currently in.
+             * @since 1.2.0
+             */
+            void push(track_link& link, void* subject, void (*sever)(void*)) {
+                if (link.previous) {
+                    unlink(link);
+                }
+
+                link.subject = subject;
+                link.sever = sever;
+                link.previous = &head;
+                link.next = head.next;
+                head.next->previous = &link;
+                head.next = &link;
+            }
+
+            /**
+             * @brief Severs every link; each `sever` call is expected to unlink its link.
+             * @since 1.2.0
+             */
+            void sever_all() {
+                while (head.next != &head) {
+                    track_link* link = head.next;
+                    link->sever(link->subject);
+                }
+            }
+
+            unsigned int size() const {
+                unsigned int count = 0;
+
+                for (const track_link* link = head.next; link != &head; link = link->next) {
+                    count++;
+                }
+                return count;
+            }
+
+        private:
+            track_link head;
+        };
+
+        /**
+         * @brief Fixed-size open-addressing set of (callback, context) pairs.
+         * @since 1.2.0
+         *
+         * Used to invoke every distinct subscriber at most once while walking
+         * several signals. When the table is full, `insert()` reports every
+         * further pair as new so no subscriber is ever skipped by mistake.
+         *
+         * Entries are stamped with the generation they were inserted in, so `clear()` empties
+         * the set by starting a new generation instead of rewriting the table. A zero-initialized
+         * set is valid; other storage must be `reset()` once before its first `clear()`.
+         *
+         * @tparam callback_type The function pointer type of the subscribers.
+         */
+        template<typename callback_type>
+        struct subscriber_set {
+            struct entry {
+                callback_type callback;
+                void* context;
+                unsigned int generation;
+
+                /**
+                 * @brief Free for the caller; `signal::compile_plan()` keeps the plan index of the pair's latest occurrence here.
+                 * @since 1.2.0
+                 */
+                int last;
+            };
+
+            entry entries[CPP_CONNECTIONS_FORWARD_DEDUPE_SLOTS];
+            unsigned int generation;
+            unsigned int count;
+
+            void reset() {
+                for (int i = 0; i < CPP_CONNECTIONS_FORWARD_DEDUPE_SLOTS; ++i) {
+                    entries[i].generation = 0;
+                }
+                generation = 0;
+            }
+
+            void clear() {
+                count = 0;
+                if (++generation == 0) {
+                    reset();
+                    generation = 1;
+                }
+            }
+
+            /**
+             * @brief Adds a pair to the set unless it is already in it.
+             * @since 1.2.0
+             *
+             * @param fresh Set to whether the pair was not in the set yet.
+             * @return The pair's entry, or nullptr if the set is full, in which case the pair counts as fresh.
+             */
+            entry* insert(callback_type callback, void* context, bool& fresh) {
+                fresh = true;
+                if (count == CPP_CONNECTIONS_FORWARD_DEDUPE_SLOTS) {
+                    return nullptr;
+                }
+
+                size_type hash = reinterpret_cast<size_type>(callback) ^ (reinterpret_cast<size_type>(context) * 31u);
+                size_type index = (hash ^ (hash >> 7)) & (CPP_CONNECTIONS_FORWARD_DEDUPE_SLOTS - 1);
+
+                while (entries[index].generation == generation) {
+                    if (entries[index].callback == callback && entries[index].context == context) {
+                        fresh = false;
+                        return &entries[index];
+                    }
+                    index = (index + 1) & (CPP_CONNECTIONS_FORWARD_DEDUPE_SLOTS - 1);
+                }
+
+                entries[index].callback = callback;
+                entries[index].context = context;
+                entries[index].generation = generation;
+                entries[index].last = -1;
+                count++;
+                return &entries[index];
+            }
+        };
+
+        /**
+         * @brief Static `subscriber_set`s reused by flattened walks, one per nesting level.
+         * @since 1.2.0
+         */
+        template<typename callback_type>
+        struct walk_storage {
+            static const int levels = 4;
+            static subscriber_set<callback_type> sets[levels];
+            static int depth;
+        };
+
+        template<typename callback_type>
+        subscriber_set<callback_type> walk_storage<callback_type>::sets[walk_storage<callback_type>::levels];
+
+        template<typename callback_type>
+        int walk_storage<callback_type>::depth = 0;
+
+        /**
+         * @brief Provides an empty `subscriber_set` for the duration of a flattened walk.
+         * @since 1.2.0
+         *
+         * The outer walks take one of the static `walk_storage` sets, which are emptied in O(1)
+         * by `subscriber_set::clear()`. Walks nested deeper than that (a subscriber firing another
+         * flattened signal from inside a walk, several levels down) fall back to a set embedded
+         * in the guard itself, which has to be reset in full.
+         *
+         * @tparam callback_type The function pointer type of the subscribers.
+         */
+        template<typename callback_type>
+        class walk_set {
+        public:
+            walk_set() {
+                int& depth = walk_storage<callback_type>::depth;
+                if (depth < walk_storage<callback_type>::levels) {
+                    set = &walk_storage<callback_type>::sets[depth];
+                } else {
+                    set = &fallback;
+                    fallback.reset();
+                }
+                depth++;
+                set->clear();
+            }
+
+            ~walk_set() {
+                walk_storage<callback_type>::depth--;
+            }
+
+            walk_set(const walk_set&) = delete;
+            walk_set& operator=(const walk_set&) = delete;
+
+            subscriber_set<callback_type>& get() {
+                return *set;
+            }
+
+        private:
+            subscriber_set<callback_type>* set;
+            subscriber_set<callback_type> fallback;
+        };
+    }
+
+    /**
+     * @brief Selects how a forwarding connection created by `forward_to()` propagates events.
+     * @since 1.2.0
+     *
+     * - `nested` calls `fire()` on the target from inside the source's dispatch loop,
+     *   so an N-deep chain nests N calls on the stack.
+     * - `flattened` lets the source's `fire()` walk the target's subscribers itself with an
+     *   explicit stack, visiting each forwarded signal at most once. A subscriber of a forwarded
+     *   signal is skipped if its (callback, context) pair already ran during the same fire.
+     *   The firing signal's own subscribers always run, exactly as they would without forwarding.
+     */
+    enum class forward_mode {
+        nested,
+        flattened
+    };
+
+    template<typename... arguments>
+    class signal;
+
+    /**
+     * @brief Bit set selecting the subscribers reached by `signal::fire_masked()`.
+     * @since 1.2.0
+     *
+     * Each bit stands for an application-defined category, for example a render layer
+     * or "visible to the network".
+     */
+    typedef unsigned long long tag_mask;
+
+    namespace detail {
+        /**
+         * @brief The state of a connection that only tracked, grouped or tagged connections need.
+         * @since 1.2.0
+         */
+        struct connection_links {
+            /**
+             * @brief Link into the list of the `trackable` the connection is tracked by, if any.
+             * @since 1.2.0
+             */
+            track_link tracking;
+
+            /**
+             * @brief Link into the member list of the `connection_group` the connection belongs to, if any.
+             * @since 1.2.0
+             */
+            track_link grouping;
+
+            /**
+             * @brief Flag of the connection's group that tells whether it may run, or nullptr if ungrouped.
+             * @since 1.2.0
+             */
+            const bool* gate;
+
+            /**
+             * @brief Categories the connection belongs to; see `signal::fire_masked()`.
+             * @since 1.2.0
+             */
+            tag_mask tags;
+
+            /**
+             * @brief Next free record while this one is in the free list of `link_pool`.
+             * @since 1.2.0
+             */
+            connection_links* next_free;
+        };
+
+        /**
+         * @brief Pool of link records shared by every connection.
+         * @since 1.2.0
+         *
+         * Starts with `CPP_CONNECTIONS_MAX_CONNECTION_LINKS` static records and allocates another
+         * block of that many whenever every record is in use, so taking a record never fails.
+         * Records are handed out in address order first and recycled through a free list,
+         * so the pool's memory is only touched as far as it was ever used. The first record
+         * of each allocated block links the blocks together instead of being handed out.
+         */
+        template<typename = void>
+        struct link_pool {
+            static connection_links records[CPP_CONNECTIONS_MAX_CONNECTION_LINKS];
+            static connection_links* free_list;
+            static connection_links* block;
+            static int touched;
+
+            /**
+             * @brief Takes an empty record from the pool, growing it if needed.
+             * @since 1.2.0
+             */
+            static connection_links* acquire() {
+                connection_links* record;
+                if (free_list) {
+                    record = free_list;
+                    free_list = record->next_free;
+                } else {
+                    if (touched == CPP_CONNECTIONS_MAX_CONNECTION_LINKS) {
+                        connection_links* added = static_cast<connection_links*>(
+                            ::operator new(sizeof(connection_links) * CPP_CONNECTIONS_MAX_CONNECTION_LINKS));
+                        added->next_free = block;
+                        block = added;
+                        touched = 1;
+                    }
+                    record = &block[touched++];
+                }
+
+                record->tracking.previous = nullptr;
+                record->grouping.previous = nullptr;
+                record->gate = nullptr;
+                record->tags = 0;
+                return record;
+            }
+
+            /**
+             * @brief Returns a record to the pool; it must be unlinked from every list.
+             * @since 1.2.0
+             */
+            static void release(connection_links* record) {
+                record->next_free = free_list;
+                free_list = record;
+            }
+        };
+
+        template<typename unused>
+        connection_links link_pool<unused>::records[CPP_CONNECTIONS_MAX_CONNECTION_LINKS];
+
+        template<typename unused>
+        connection_links* link_pool<unused>::free_list = nullptr;
+
+        template<typename unused>
+        connection_links* link_pool<unused>::block = link_pool<unused>::records;
+
+        template<typename unused>
+        int link_pool<unused>::touched = 0;
+    }
+
     /**
      * @brief Represents an individual registered connection between a signal and a callback.
      * @since 1.0.0
@@ -114,6 +834,23 @@ namespace connections {
          */
         bool once;
 
+        /**
+         * @brief Dispatch priority of this connection.
+         * @since 1.2.0
+         *
+         * Connections with a higher priority run before those with a lower one,
+         * and connections of equal priority run in the order they were connected.
+         */
+        int priority;
+
+        /**
+         * @brief Number the owning signal gave this connection when it was made.
+         * @since 1.2.0
+         *
+         * Orders connections of equal priority, including those in the one-shot ring.
+         */
+        unsigned long long sequence;
+
         /**
          * @brief Pointer to the callback function to invoke when the signal fires.
          * @since 1.0.0
@@ -135,618 +872,7691 @@ namespace connections {
         void* context;
 
         /**
-         * @brief Disconnects this connection by marking it as inactive.
-         * @since 1.0.0
+         * @brief The signal this connection was registered with, or nullptr.
+         * @since 1.2.0
          *
-         * This method disables the connection, causing the owning signal to
-         * ignore it during future firing operations. This does not deallocate
-         * memory but flags the connection as logically disconnected.
+         * Used by `disconnect()` to tell the signal that one of its dispatch
+         * entries went stale. Connections stored outside a `signal` leave it null.
          */
-        void disconnect() {
-            connected = false;
+        signal<arguments...>* owner;
+
+        /**
+         * @brief Tracking, grouping and tag state, or nullptr while the connection uses none of them.
+         * @since 1.2.0
+         *
+         * Taken from `detail::link_pool` on first use and returned when the connection disconnects.
+         */
+        detail::connection_links* links;
+
+        /**
+         * @brief Returns whether the connection's group is suspended or the connection is blocked.
+         * @since 1.2.0
+         *
+         * Muted connections stay connected but are skipped by every dispatch.
+         */
+        bool muted() const {
+            return (links && links->gate && !*links->gate) || blocked();
         }
-    };
 
-    /**
-     * @brief Manages a fixed-size container of connections and dispatches events to them.
-     * @since 1.0.0
-     *
-     * This class implements a simple but efficient signal-slot event mechanism.
-     * Clients can register multiple callbacks (connections) with this signal,
-     * which will be invoked sequentially in the order they were added when the
-     * signal is fired.
-     *
-     * The container has a fixed maximum capacity defined by `CPP_CONNECTIONS_MAX_CONNECTIONS`.
-     * Attempting to add more connections beyond this limit will fail.
-     *
-     * Signals provide both persistent and one-shot connection registration, forwarding,
-     * and management functions to control and modify connection behavior.
-     *
-     * @tparam arguments Template parameter pack specifying the argument types
-     *                   that will be forwarded to each callback upon firing.
-     */
-    template<typename... arguments>
-    class signal {
-    public:
         /**
-         * @brief Constructs a new signal instance with all connections initially disconnected.
-         * @since 1.0.0
+         * @brief Mutes this connection until `unblock()` is called, keeping its place in the dispatch order.
+         * @since 1.2.0
          *
-         * The constructor initializes the internal connection array by marking
-         * every slot as disconnected. The signal starts in an active state,
-         * allowing callbacks to be invoked upon firing.
+         * Only connections registered with a `signal` can be blocked; for others this does nothing.
          */
-        signal() : active(true) {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                connections[i].disconnect();
+        void block() {
+            if (connected && owner) {
+                owner->set_blocked(this, true);
             }
         }
 
         /**
-         * @brief Copy constructor.
-         * @since 1.1.0
-         *
-         * Creates a new signal instance as a copy of another signal.
-         * All internal connection states, callbacks, contexts, and flags
-         * are duplicated, preserving the exact signal state.
-         *
-         * This allows independent copies of signals where connections remain consistent,
-         * without sharing pointers or references.
-         *
-         * @param other The signal instance to copy from.
+         * @brief Lets a connection muted by `block()` run again.
+         * @since 1.2.0
          */
-        signal(const signal& other) : active(other.active) {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                connections[i] = other.connections[i];
+        void unblock() {
+            if (connected && owner) {
+                owner->set_blocked(this, false);
             }
         }
 
         /**
-         * @brief Copy assignment operator.
-         * @since 1.1.0
-         *
-         * Assigns the contents and state of another signal instance to this one.
-         * Existing connections are overwritten by the copied signal’s connections,
-         * and the active state is updated accordingly.
-         *
-         * Self-assignment is safely handled by checking the address before copying.
-         *
-         * @param other The signal instance to copy from.
-         * @return Reference to this signal after assignment.
+         * @brief Returns whether the connection is blocked.
+         * @since 1.2.0
          */
-        signal& operator=(const signal& other) {
-            if (this != &other) {
-                active = other.active;
-                for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                    connections[i] = other.connections[i];
-                }
-            }
-            return *this;
+        bool blocked() const {
+            return owner && owner->is_blocked(this);
         }
 
         /**
-         * @brief Move constructor.
-         * @since 1.1.0
-         *
-         * Moves the state of another signal instance into this one.
-         * The other instance is left in a valid but unspecified state.
+         * @brief Returns the categories this connection belongs to; see `signal::fire_masked()`.
+         * @since 1.2.0
          *
-         * This efficiently transfers ownership of all connection states,
-         * callback pointers, contexts, and the active flag without copying.
-         *
-         * @param other The signal instance to move from.
+         * New connections belong to no category.
          */
-        signal(signal&& other) noexcept : active(other.active) {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                connections[i] = move(other.connections[i]);
-            }
-            other.active = false;
+        tag_mask tags() const {
+            return links ? links->tags : 0;
         }
 
         /**
-         * @brief Move assignment operator.
-         * @since 1.1.0
+         * @brief Sets the categories this connection belongs to.
+         * @since 1.2.0
          *
-         * Moves the state of another signal instance into this one, overwriting
-         * the current state. The other instance is left in a valid but unspecified state.
-         *
-         * Self-move assignment is safely handled by checking the address before moving.
+         * Tagging takes a record from `detail::link_pool`, unless the connection already holds one.
          *
-         * @param other The signal instance to move from.
-         * @return Reference to this signal after assignment.
+         * @param mask The new categories; `signal::fire_masked(mask, ...)` reaches the connection
+         *             when `mask` shares at least one bit with them.
+         * @return `false` if the connection is disconnected, `true` otherwise.
          */
-        signal& operator=(signal&& other) noexcept {
-            if (this != &other) {
-                active = other.active;
-                for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                    connections[i] = move(other.connections[i]);
-                }
-                other.active = false;
+        bool set_tags(tag_mask mask) {
+            if (!connected) {
+                return false;
             }
-            return *this;
+
+            if (mask) {
+                acquire_links();
+            }
+            if (links) {
+                links->tags = mask;
+            }
+            if (owner) {
+                owner->retag(this);
+            }
+            return true;
         }
 
         /**
-         * @brief Destructor automatically disconnects all connections managed by this signal.
-         * @since 1.1.0
-         *
-         * Upon destruction, this destructor calls `disconnect_all()` to ensure
-         * no lingering active connections remain, preventing potential callbacks
-         * to destroyed or invalid contexts.
+         * @brief Makes sure the connection holds a record from `detail::link_pool`.
+         * @since 1.2.0
          */
-        ~signal() {
-            disconnect_all();
+        void acquire_links() {
+            if (!links) {
+                links = detail::link_pool<>::acquire();
+            }
         }
 
         /**
-         * @brief Registers a persistent callback function with an associated user context.
-         * @since 1.0.0
-         *
-         * This method searches for an available slot in the internal connection array.
-         * If a free slot is found, it activates the connection, stores the callback
-         * function pointer and the user context, and returns a pointer to the new connection.
-         *
-         * If the maximum number of connections has been reached, it returns nullptr.
-         *
-         * @param function Pointer to the callback function to invoke on signal firing.
-         * @param context User-defined pointer passed to the callback when invoked.
-         * @return Pointer to the newly created connection if successful, nullptr if full.
+         * @brief Unlinks the connection from its `trackable` and `connection_group` and returns its record.
+         * @since 1.2.0
          */
-        connection<arguments...>* connect(void (*function)(void* context, arguments...), void* context) {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                if (!connections[i].connected) {
-                    connections[i].connected = true;
-                    connections[i].once = false;
-                    connections[i].callback = function;
-                    connections[i].context = context;
-                    return &connections[i];
-                }
+        void release_links() {
+            if (!links) {
+                return;
+            }
+
+            if (links->tracking.previous) {
+                detail::unlink(links->tracking);
+            }
+            if (links->grouping.previous) {
+                detail::unlink(links->grouping);
             }
-            return nullptr;
+            detail::link_pool<>::release(links);
+            links = nullptr;
         }
 
         /**
-         * @brief Registers a one-shot callback function with an associated user context.
-         * @since 1.1.0
-         *
-         * Similar to `connect()`, but the resulting connection will automatically
-         * disconnect itself after the callback is invoked once, ensuring the listener
-         * responds to only a single event.
+         * @brief Disconnects this connection by marking it as inactive.
+         * @since 1.0.0
          *
-         * @param function Pointer to the callback function to invoke on signal firing.
-         * @param context User-defined pointer passed to the callback when invoked.
-         * @return Pointer to the new connection if successful, nullptr if full.
+         * This method disables the connection, causing the owning signal to
+         * ignore it during future firing operations. This does not deallocate
+         * memory but flags the connection as logically disconnected.
          */
-        connection<arguments...>* once(void (*function)(void* context, arguments...), void* context) {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                if (!connections[i].connected) {
-                    connections[i].connected = true;
-                    connections[i].once = true;
-                    connections[i].callback = function;
-                    connections[i].context = context;
-                    return &connections[i];
+        void disconnect() {
+            if (connected) {
+                connected = false;
+
+                if (owner) {
+                    owner->release(this);
                 }
+                release_links();
             }
-            return nullptr;
         }
 
         /**
-         * @brief Sets up forwarding from this signal to another signal.
-         * @since 1.1.0
+         * @brief Disconnects the connection a `detail::track_link` belongs to.
+         * @since 1.2.0
          *
-         * This method registers a connection on this signal that, when fired,
-         * will invoke the `fire()` method on the target signal with the same arguments.
-         * This effectively links the two signals so that events propagate from this
-         * signal to the target.
+         * Installed as the `sever` function of the links used by `trackable` and `connection_group`.
          *
-         * @param target Pointer to the signal instance that should receive forwarded events.
-         * @return Pointer to the internal connection object responsible for forwarding.
+         * @param subject The connection to disconnect.
          */
-        connection<arguments...>* forward_to(signal<arguments...>* target) {
-            return connect(
-                [](void* context, arguments... args) {
-                    auto* tgt = static_cast<signal<arguments...>*>(context);
-                    tgt->fire(args...);
-                },
-                static_cast<void*>(target)
-            );
+        static void sever(void* subject) {
+            static_cast<connection*>(subject)->disconnect();
         }
+    };
+
+    template<typename... arguments>
+    class event_log;
 
+    template<typename... arguments>
+    class dispatch_plan;
+
+    /**
+     * @brief Point in time or duration measured in the ticks of a `timer_wheel`.
+     * @since 1.2.0
+     *
+     * The length of a tick is up to the application, typically one millisecond or one frame.
+     */
+    typedef unsigned long long timer_ticks;
+
+    /**
+     * @brief Hierarchical timer wheel with a fixed pool of timers, advanced explicitly by the application.
+     * @since 1.2.0
+     *
+     * Timers are sorted into four levels of 64 slots each, where a slot of level `n` spans
+     * `64^n` ticks. Scheduling and cancelling a timer are O(1). As time advances, the timers
+     * of a higher-level slot are redistributed into lower levels once their slot comes up,
+     * so every timer is moved at most once per level before it expires. Deadlines further
+     * away than `64^4` ticks are parked in the top level and redistributed as time goes by.
+     *
+     * Nothing happens on its own: `tick()` runs every timer whose deadline has been reached,
+     * on the calling thread. Timers never allocate; each carries
+     * `CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES` of inline storage that signals use for their
+     * timed operations (see `signal::once_with_timeout()`).
+     */
+    class timer_wheel {
+    public:
         /**
-         * @brief Disconnects all currently active connections from this signal.
-         * @since 1.1.0
+         * @brief A timer of the wheel, used as the handle returned by `schedule()`.
+         * @since 1.2.0
          *
-         * This method iterates over the entire internal connection array and
-         * marks all active connections as disconnected. After calling this,
-         * the signal will have no listeners and invoking `fire()` will result
-         * in no callbacks being called.
+         * A handle stays valid until its timer expires or is cancelled; after that
+         * the timer may be reused for another schedule.
          */
-        void disconnect_all() {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                if (connections[i].connected) {
-                    connections[i].disconnect();
-                }
-            }
-        }
+        class timer {
+        private:
+            friend class timer_wheel;
+
+            template<typename... arguments>
+            friend class signal;
+
+            /**
+             * @brief Tick at which the timer expires.
+             * @since 1.2.0
+             */
+            timer_ticks deadline;
+
+            /**
+             * @brief Called with `context` when the timer expires.
+             * @since 1.2.0
+             */
+            void (*expire)(void* context);
+
+            /**
+             * @brief Called with `context` when the timer is released, or nullptr.
+             * @since 1.2.0
+             */
+            void (*destroy)(void* context);
+
+            /**
+             * @brief User-defined pointer passed to `expire` and `destroy`.
+             * @since 1.2.0
+             */
+            void* context;
+
+            /**
+             * @brief Neighbors in the slot list, or the next vacant timer in the free list.
+             * @since 1.2.0
+             */
+            timer* previous;
+            timer* next;
+
+            /**
+             * @brief Level and slot holding the timer; `level` is -1 while it is not scheduled.
+             * @since 1.2.0
+             */
+            int level;
+            int slot;
+
+            /**
+             * @brief Inline storage for the owner of the timer.
+             * @since 1.2.0
+             */
+            union {
+                unsigned char bytes[CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES];
+                void* pointer;
+                unsigned long long integer;
+                long double real;
+            } payload;
+        };
 
         /**
-         * @brief Disconnects all connections whose callback function pointer matches the given pointer.
-         * @since 1.1.0
-         *
-         * This method searches all active connections and disconnects those
-         * whose callback function pointer is equal to the specified function pointer.
-         * Useful for bulk removing listeners that share the same callback.
+         * @brief Constructs a wheel with no pending timers.
+         * @since 1.2.0
          *
-         * @param callback The callback function pointer to match and disconnect.
+         * @param start The current time of the wheel.
          */
-        void disconnect_by_callback(void (*callback)(void*, arguments...)) {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                if (connections[i].connected && connections[i].callback == callback) {
-                    connections[i].disconnect();
+        explicit timer_wheel(timer_ticks start = 0) : current(start), vacant(timers), expiring(nullptr), ticking(false) {
+            for (int level = 0; level < levels; ++level) {
+                counts[level] = 0;
+                for (int slot = 0; slot < slots_per_level; ++slot) {
+                    slots[level][slot] = nullptr;
                 }
             }
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_TIMERS; ++i) {
+                timers[i].level = -1;
+                timers[i].next = i + 1 < CPP_CONNECTIONS_MAX_TIMERS ? &timers[i + 1] : nullptr;
+            }
         }
 
+        timer_wheel(const timer_wheel&) = delete;
+        timer_wheel& operator=(const timer_wheel&) = delete;
+
         /**
-         * @brief Disconnects all connections whose user context pointer matches the given pointer.
-         * @since 1.1.0
-         *
-         * This method iterates through all active connections and disconnects
-         * those whose context pointer matches the provided context.
-         * This is helpful for removing all listeners associated with a particular object or context.
+         * @brief Destroys the wheel, dropping every pending timer without running it.
+         * @since 1.2.0
          *
-         * @param context The user-defined context pointer to match and disconnect.
+         * Signals with timed operations pending on the wheel must not outlive it.
          */
-        void disconnect_by_context(void* context) {
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                if (connections[i].connected && connections[i].context == context) {
-                    connections[i].disconnect();
+        ~timer_wheel() {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_TIMERS; ++i) {
+                if (timers[i].level >= 0 && timers[i].destroy) {
+                    timers[i].destroy(timers[i].context);
                 }
             }
         }
 
         /**
-         * @brief Suspends the signal, preventing any callbacks from being invoked during `fire()`.
-         * @since 1.1.0
+         * @brief Schedules a callback to run once the wheel reaches the given time.
+         * @since 1.2.0
          *
-         * When a signal is suspended, it maintains its list of active connections,
-         * but temporarily disables callback invocation. This allows pausing event
-         * dispatch without disconnecting or removing listeners.
+         * Deadlines that already passed expire on the next tick.
+         *
+         * @param deadline Tick at which the callback runs.
+         * @param callback Function invoked by `tick()`.
+         * @param context User-defined pointer passed to the callback.
+         * @return Handle of the timer, or nullptr if all `CPP_CONNECTIONS_MAX_TIMERS` timers are pending.
          */
-        void suspend() {
-            active = false;
+        timer* schedule(timer_ticks deadline, void (*callback)(void* context), void* context) {
+            timer* added = acquire();
+            if (added) {
+                arm(added, deadline, callback, nullptr, context);
+            }
+            return added;
         }
 
         /**
-         * @brief Resumes the signal, allowing callbacks to be invoked normally during `fire()`.
-         * @since 1.1.0
+         * @brief Cancels a pending timer in O(1).
+         * @since 1.2.0
          *
-         * This re-enables callback dispatch after a prior suspension, restoring
-         * normal signal behavior without needing to reconnect listeners.
+         * @param handle A handle returned by `schedule()`.
+         * @return `true` if the timer was pending, `false` if it already expired or was cancelled.
          */
-        void resume() {
-            active = true;
+        bool cancel(timer* handle) {
+            if (!handle || handle->level < 0) {
+                return false;
+            }
+
+            unlink(handle);
+            if (handle != expiring) {
+                finish(handle);
+            }
+            return true;
         }
 
         /**
-         * @brief Fires the signal, invoking all active callbacks with the provided arguments if active.
-         * @since 1.0.0
+         * @brief Advances the wheel to `now`, running every timer whose deadline is reached.
+         * @since 1.2.0
          *
-         * This function iterates through all registered connections and invokes
-         * the callbacks for each connection that is currently active and connected.
-         * One-shot connections are automatically disconnected immediately after invocation.
+         * Timers run in deadline order; timers with the same deadline run in no particular
+         * order. Callbacks may schedule and cancel timers, and signals re-arm periodic timers
+         * from their callback, which keeps the handle valid. Stretches of time without pending
+         * timers in the lower levels are skipped, so advancing across a long idle period
+         * costs no more than the few slots that actually hold timers.
          *
-         * If the signal is suspended (not active), this function returns immediately
-         * without invoking any callbacks.
+         * Calls made from inside a timer callback do nothing.
          *
-         * @param args The argument pack forwarded to each callback function.
+         * @param now The new current time. Times before the current time are ignored.
+         * @return Number of timers that ran.
          */
-        void fire(arguments... args) {
-            if (!active) {
-                return;
+        unsigned int tick(timer_ticks now) {
+            if (ticking) {
+                return 0;
             }
 
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                if (connections[i].connected && connections[i].callback) {
-                    connections[i].callback(connections[i].context, args...);
+            ticking = true;
+            unsigned int expired = 0;
+
+            while (current < now) {
+                int empty = 0;
+                while (empty < levels && counts[empty] == 0) {
+                    empty++;
+                }
+                if (empty == levels) {
+                    current = now;
+                    break;
+                }
+
+                timer_ticks next = current + 1;
+                if (empty > 0) {
+                    next = (current | (span(empty) - 1)) + 1;
+                    if (next > now) {
+                        current = now;
+                        break;
+                    }
+                }
+                current = next;
+
+                for (int level = levels - 1; level > 0; --level) {
+                    if ((next & (span(level) - 1)) == 0) {
+                        cascade(level, static_cast<int>((next / span(level)) & (slots_per_level - 1)));
+                    }
+                }
 
-                    if (connections[i].once) {
-                        connections[i].disconnect();
+                int slot = static_cast<int>(next & (slots_per_level - 1));
+                while (timer* due = slots[0][slot]) {
+                    unlink(due);
+                    expiring = due;
+                    due->expire(due->context);
+                    expiring = nullptr;
+
+                    if (due->level < 0) {
+                        finish(due);
                     }
+                    expired++;
                 }
             }
+
+            ticking = false;
+            return expired;
         }
 
         /**
-         * @brief Returns the compile-time maximum number of connections this signal can manage.
-         * @since 1.1.0
-         *
-         * This value reflects the fixed-size capacity of the internal connections array,
-         * as defined by the macro `CPP_CONNECTIONS_MAX_CONNECTIONS`.
-         *
-         * @return The maximum number of simultaneous connections supported by this signal.
+         * @brief Returns the current time of the wheel.
+         * @since 1.2.0
          */
-        int max_connections() const {
-            return CPP_CONNECTIONS_MAX_CONNECTIONS;
+        timer_ticks now() const {
+            return current;
         }
 
         /**
-         * @brief Returns the current number of active connections registered to this signal.
-         * @since 1.1.0
-         *
-         * Iterates through the internal connection array and counts how many
-         * connections are marked as connected (active and not disconnected).
-         *
-         * @return The count of currently connected callbacks.
+         * @brief Returns the number of pending timers.
+         * @since 1.2.0
          */
-        unsigned int connection_count() const {
-            unsigned int count = 0;
-
-            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
-                if (connections[i].connected) {
-                    count++;
-                }
+        unsigned int size() const {
+            unsigned int total = 0;
+            for (int level = 0; level < levels; ++level) {
+                total += counts[level];
             }
-            return count;
+            return total;
         }
-    private:
+
         /**
-         * @brief Flag indicating whether the signal is currently active and firing callbacks.
-         * @since 1.1.0
-         *
-         * When this flag is set to false, calls to `fire()` will immediately return
-         * without invoking any callbacks, effectively suspending event dispatch.
-         * Connections remain registered and can be resumed later.
+         * @brief Returns the compile-time maximum number of pending timers.
+         * @since 1.2.0
          */
-        bool active;
+        int capacity() const {
+            return CPP_CONNECTIONS_MAX_TIMERS;
+        }
+
+    private:
+        template<typename... arguments>
+        friend class signal;
 
         /**
-         * @brief Fixed-size array storing all possible connection slots managed by this signal.
-         * @since 1.0.0
-         *
-         * Each element represents a possible registered callback connection,
-         * including its active status, callback pointer, and context.
-         * The size is defined by `CPP_CONNECTIONS_MAX_CONNECTIONS`.
+         * @brief Number of levels of the wheel.
+         * @since 1.2.0
          */
-        connection<arguments...> connections[CPP_CONNECTIONS_MAX_CONNECTIONS];
-    };
+        static const int levels = 4;
 
-    /**
-     * @brief RAII-style scoped wrapper for managing a single connection's lifetime.
-     * @since 1.1.0
-     *
-     * This utility struct provides automatic management of a pointer to a
-     * `connection` object, ensuring that the connection is properly disconnected
-     * when the scoped_connection instance is destroyed. This pattern helps prevent
-     * dangling connections and resource leaks by tying the connection's lifetime
-     * to the scoped_connection's lifetime, following RAII (Resource Acquisition Is Initialization).
-     *
-     * The class disables copy operations to avoid multiple owners of the same
-     * connection, which could lead to double-disconnect errors or undefined behavior.
-     * Move semantics are supported to allow transferring ownership safely.
-     *
-     * Typical usage includes creating a scoped_connection from a raw connection pointer
-     * returned by a signal's `connect()` method, allowing the connection to be
-     * automatically disconnected when the scoped_connection goes out of scope.
-     *
-     * @tparam arguments The variadic template parameter pack representing the
-     *                   argument types that the underlying connection's callback accepts.
-     */
-    template<typename... arguments>
-    struct scoped_connection {
         /**
-         * @brief Pointer to the managed connection object.
-         * @since 1.1.0
-         *
-         * This raw pointer holds the address of the connection being managed by this
-         * scoped_connection instance. It may be nullptr, indicating no connection
-         * is currently managed. When valid and the connection is active (`connected == true`),
-         * this pointer is used to invoke `disconnect()` automatically upon destruction.
-         *
-         * Ownership semantics:
-         * - The scoped_connection assumes responsibility for disconnecting the connection,
-         *   but does not delete or free the pointer itself.
-         * - After destruction or move, this pointer is reset to nullptr to avoid dangling references.
+         * @brief Number of slots per level; a power of two.
+         * @since 1.2.0
          */
-        connection<arguments...>* conn = nullptr;
+        static const int slots_per_level = 64;
 
         /**
-         * @brief Default constructor creates an empty scoped_connection managing no connection.
-         * @since 1.1.0
-         *
-         * The constructed object will hold a null connection pointer,
-         * meaning no connection is managed and no disconnection will occur
-         * upon destruction unless a connection is assigned later.
+         * @brief Returns the number of ticks covered by one slot of `level`.
+         * @since 1.2.0
          */
-        scoped_connection() = default;
+        static timer_ticks span(int level) {
+            timer_ticks ticks = 1;
+            for (int i = 0; i < level; ++i) {
+                ticks *= slots_per_level;
+            }
+            return ticks;
+        }
 
         /**
-         * @brief Constructs a scoped_connection that takes ownership of the given connection pointer.
-         * @since 1.1.0
+         * @brief Takes a vacant timer out of the pool without scheduling it.
+         * @since 1.2.0
          *
-         * The provided connection pointer is assumed to point to a valid connection
-         * object whose lifetime is managed externally. This constructor does not
-         * allocate or create a connection; it only takes responsibility for calling
-         * `disconnect()` on destruction.
+         * Lets signals construct their bookkeeping in the timer's payload before `arm()`.
          *
-         * @param c Pointer to the connection to manage. Must not be deleted
-         *          by this scoped_connection, but will be disconnected on destruction.
+         * @return A vacant timer, or nullptr if every timer is pending.
          */
-        explicit scoped_connection(connection<arguments...>* c) : conn(c) {}
+        timer* acquire() {
+            timer* taken = vacant;
+            if (taken) {
+                vacant = taken->next;
+            }
+            return taken;
+        }
 
         /**
-         * @brief Destructor automatically disconnects the managed connection if it is active.
-         * @since 1.1.0
-         *
-         * When the scoped_connection goes out of scope or is destroyed, this destructor
-         * checks whether it currently owns a non-null pointer to an active connection.
-         * If so, it calls the connection's `disconnect()` method to mark the connection
-         * as inactive and prevent further callback invocations.
-         *
-         * This automatic disconnection helps ensure that dangling callbacks or
-         * unexpected invocations do not occur after the scoped_connection is destroyed,
-         * thereby improving safety and resource management.
+         * @brief Schedules a timer taken with `acquire()`, or re-arms the timer currently expiring.
+         * @since 1.2.0
          */
-        ~scoped_connection() {
-            if (conn && conn->connected) {
-                conn->disconnect();
-            }
+        void arm(timer* handle, timer_ticks deadline, void (*expire)(void*), void (*destroy)(void*), void* context) {
+            handle->deadline = deadline > current ? deadline : current + 1;
+            handle->expire = expire;
+            handle->destroy = destroy;
+            handle->context = context;
+            insert(handle);
         }
 
         /**
-         * @brief Copy constructor is explicitly deleted to prevent copying ownership.
-         * @since 1.1.0
-         *
-         * Copying scoped_connection objects is disallowed because multiple instances
-         * managing the same connection pointer could lead to double disconnection attempts
-         * and undefined behavior. This ensures unique ownership semantics.
+         * @brief Returns a timer that is not scheduled to the pool.
+         * @since 1.2.0
          */
-        scoped_connection(const scoped_connection&) = delete;
+        void release(timer* handle) {
+            handle->level = -1;
+            handle->next = vacant;
+            vacant = handle;
+        }
 
         /**
-         * @brief Copy assignment operator is explicitly deleted to prevent copying ownership.
-         * @since 1.1.0
-         *
-         * Copy assignment is disabled for the same reasons as the copy constructor:
-         * to enforce exclusive ownership and avoid resource management errors.
+         * @brief Destroys the payload of an unscheduled timer and returns it to the pool.
+         * @since 1.2.0
          */
-        scoped_connection& operator=(const scoped_connection&) = delete;
+        void finish(timer* handle) {
+            if (handle->destroy) {
+                handle->destroy(handle->context);
+            }
+            release(handle);
+        }
 
         /**
-         * @brief Move constructor transfers ownership of the managed connection pointer.
-         * @since 1.1.0
-         *
-         * This constructor enables transferring the management responsibility from
-         * an existing scoped_connection to a new instance, leaving the moved-from
-         * instance in a valid but empty state with a null pointer.
-         *
-         * Ownership is transferred by moving the raw connection pointer,
-         * preventing disconnection from being called multiple times.
+         * @brief Links a timer into the slot matching its distance from the current time.
+         * @since 1.2.0
          *
-         * @param other The scoped_connection instance to move from.
+         * The lowest level whose range covers the distance is used, so the slot comes up
+         * strictly after the current time, or exactly at it for level 0 during a cascade.
          */
-        scoped_connection(scoped_connection&& other) noexcept : conn(other.conn) {
-            other.conn = nullptr;
+        void insert(timer* handle) {
+            timer_ticks distance = handle->deadline - current;
+            timer_ticks position = handle->deadline;
+            if (distance >= span(levels)) {
+                position = current + span(levels) - 1;
+            }
+
+            int level = 0;
+            while (level < levels - 1 && distance >= span(level + 1)) {
+                level++;
+            }
+
+            int slot = static_cast<int>((position / span(level)) & (slots_per_level - 1));
+            timer*& head = slots[level][slot];
+            handle->level = level;
+            handle->slot = slot;
+            handle->previous = nullptr;
+            handle->next = head;
+            if (head) {
+                head->previous = handle;
+            }
+            head = handle;
+            counts[level]++;
         }
 
         /**
-         * @brief Move assignment operator disconnects current connection if active,
-         *        then takes ownership from the given scoped_connection.
-         * @since 1.1.0
-         *
-         * This operator enables assignment of a scoped_connection by transferring
-         * ownership of the managed connection pointer from the `other` instance.
-         * If this instance currently manages a connection, it will first disconnect it
-         * to prevent leaks or lingering callbacks before taking over the new connection.
-         *
-         * After assignment, the moved-from instance is left in a valid empty state.
-         *
-         * @param other The scoped_connection instance to move from.
-         * @return Reference to this scoped_connection after assignment.
+         * @brief Unlinks a scheduled timer from its slot.
+         * @since 1.2.0
          */
-        scoped_connection& operator=(scoped_connection&& other) noexcept {
-            if (this != &other) {
-                if (conn && conn->connected) {
-                    conn->disconnect();
-                }
-                conn = other.conn;
-                other.conn = nullptr;
+        void unlink(timer* handle) {
+            if (handle->previous) {
+                handle->previous->next = handle->next;
+            } else {
+                slots[handle->level][handle->slot] = handle->next;
             }
-            return *this;
+            if (handle->next) {
+                handle->next->previous = handle->previous;
+            }
+
+            counts[handle->level]--;
+            handle->level = -1;
         }
 
         /**
-         * @brief Releases ownership of the managed connection without disconnecting it.
-         * @since 1.1.0
-         *
-         * This function relinquishes management responsibility over the connection,
-         * returning the raw pointer to the caller and setting the internal pointer
-         * to nullptr to prevent disconnection on destruction.
-         *
-         * After calling `release()`, the scoped_connection no longer affects the connection's lifetime,
-         * and the caller assumes full responsibility for managing the connection manually.
-         *
-         * @return The raw pointer to the managed connection prior to release, or nullptr if none.
+         * @brief Redistributes the timers of a higher-level slot whose time has come.
+         * @since 1.2.0
          */
-        connection<arguments...>* release() {
-            auto temp = conn;
-            conn = nullptr;
-            return temp;
+        void cascade(int level, int slot) {
+            timer* moved = slots[level][slot];
+            slots[level][slot] = nullptr;
+
+            while (moved) {
+                timer* next = moved->next;
+                counts[level]--;
+                insert(moved);
+                moved = next;
+            }
         }
+
+        /**
+         * @brief Heads of the slot lists, per level.
+         * @since 1.2.0
+         */
+        timer* slots[levels][slots_per_level];
+
+        /**
+         * @brief Number of timers per level.
+         * @since 1.2.0
+         */
+        unsigned int counts[levels];
+
+        /**
+         * @brief Timer pool.
+         * @since 1.2.0
+         */
+        timer timers[CPP_CONNECTIONS_MAX_TIMERS];
+
+        /**
+         * @brief Time up to which every slot has been processed.
+         * @since 1.2.0
+         */
+        timer_ticks current;
+
+        /**
+         * @brief Head of the list of vacant timers.
+         * @since 1.2.0
+         */
+        timer* vacant;
+
+        /**
+         * @brief Timer whose callback is running, which is released after it returns unless re-armed.
+         * @since 1.2.0
+         */
+        timer* expiring;
+
+        /**
+         * @brief Whether `tick()` is running.
+         * @since 1.2.0
+         */
+        bool ticking;
     };
 
     /**
-     * @brief Connects a pre-existing connection object’s callback to a given signal.
-     * @since 1.0.0
-     *
-     * This free function facilitates connecting a callback described by a
-     * `connection` struct to a specified signal instance, forwarding the
-     * callback function pointer and user context stored in the connection.
-     *
-     * This is useful when managing or copying connection descriptors externally
-     * before registering them to signals.
+     * @brief Source of monotonic time for the rate-limiting signal adaptors.
+     * @since 1.2.0
      *
-     * @param connection The connection struct containing the callback and context.
-     * @param signal Pointer to the signal instance where the callback should be connected.
-     * @return Pointer to the internal connection object inside the signal, or nullptr if the signal is full.
+     * The library has no clock of its own; the application supplies one, which also
+     * makes the adaptors deterministic under test.
      */
-    template<typename... arguments>
-    connection<arguments...>* connect(const connection<arguments...>& connection, signal<arguments...>* signal) {
-        return signal->connect(connection.callback, connection.context);
+    struct monotonic_clock {
+        /**
+         * @brief Returns the current time, which must never decrease.
+         * @since 1.2.0
+         */
+        timer_ticks (*now)(void* user);
+
+        /**
+         * @brief User-defined pointer passed to `now`.
+         * @since 1.2.0
+         */
+        void* user;
+    };
+
+    namespace detail {
+        inline timer_ticks wheel_time(void* wheel) {
+            return static_cast<const timer_wheel*>(wheel)->now();
+        }
     }
 
     /**
-     * @brief Connects a one-shot connection object’s callback to a signal.
-     * @since 1.1.0
-     *
-     * Similar to `connect()`, but this function registers the callback as a one-shot listener,
-     * which will disconnect itself automatically after the first invocation.
-     *
-     * This facilitates easily setting up single-use event listeners externally.
+     * @brief Returns a clock that reads the current time of a timer wheel.
+     * @since 1.2.0
      *
-     * @param connection The connection struct containing the callback and context.
-     * @param signal Pointer to the signal instance to register with.
-     * @return Pointer to the internal connection object inside the signal, or nullptr if full.
+     * @param wheel The wheel to read, which must outlive the clock.
      */
-    template<typename... arguments>
-    connection<arguments...>* connect_once(const connection<arguments...>& connection, signal<arguments...>* signal) {
-        return signal->once(connection.callback, connection.context);
+    inline monotonic_clock wheel_clock(timer_wheel& wheel) {
+        monotonic_clock clock = { &detail::wheel_time, &wheel };
+        return clock;
     }
 
     /**
-     * @brief Establishes forwarding of events from one signal to another.
-     * @note This is a convenience function that calls the `forward_to` member on the source signal.
-     * @since 1.1.0
-     *
-     * When invoked, it sets up the source signal to automatically invoke
-     * the target signal whenever it is fired, forwarding all event arguments transparently.
+     * @brief Limits how much of an incremental dispatch one call may run.
+     * @since 1.2.0
      *
-     * This is useful for composing signals or chaining event propagation.
+     * A call stops once it invoked `callbacks` callbacks or, when `clock` is set, once the
+     * clock reads `deadline` or later. Either limit is disabled by setting it to zero or
+     * nullptr. The clock is read after every callback, and at least one callback runs per
+     * call, so a pass always makes progress.
+     */
+    struct dispatch_budget {
+        /**
+         * @brief Maximum number of callbacks to invoke, or zero for no limit.
+         * @since 1.2.0
+         */
+        unsigned int callbacks;
+
+        /**
+         * @brief Time source for `deadline`, or nullptr for no time limit.
+         * @since 1.2.0
+         */
+        const monotonic_clock* clock;
+
+        /**
+         * @brief Time at which the call stops.
+         * @since 1.2.0
+         */
+        timer_ticks deadline;
+    };
+
+    /**
+     * @brief Returns a budget of at most `count` callbacks.
+     * @since 1.2.0
+     */
+    inline dispatch_budget callback_budget(unsigned int count) {
+        dispatch_budget budget = { count, nullptr, 0 };
+        return budget;
+    }
+
+    /**
+     * @brief Returns a budget that runs callbacks until `clock` reads `deadline`.
+     * @since 1.2.0
      *
-     * @param from Pointer to the source signal that will forward its events.
-     * @param to Pointer to the destination signal that will receive forwarded events.
-     * @return Pointer to the connection object responsible for the forwarding, allowing management or disconnection.
+     * @param clock The time source, which must outlive every call the budget is passed to.
+     * @param deadline Time at which the call stops.
      */
-    template<typename... arguments>
-    connection<arguments...>* forward_to(signal<arguments...>* from, signal<arguments...>* to) {
-        return from->forward_to(to);
+    inline dispatch_budget time_budget(const monotonic_clock& clock, timer_ticks deadline) {
+        dispatch_budget budget = { 0, &clock, deadline };
+        return budget;
+    }
+
+    namespace detail {
+        /**
+         * @brief Position of an incremental dispatch pass within a signal's dispatch order.
+         * @since 1.2.0
+         *
+         * The position is kept as the priority and sequence of the last connection reached rather
+         * than as an index, so it stays valid while the dispatch order is compacted between calls.
+         * Connections whose sequence is `bound` or later were made after the pass began.
+         */
+        struct dispatch_cursor {
+            int priority;
+            unsigned long long sequence;
+            unsigned long long bound;
+            bool started;
+        };
     }
 
     /**
-     * @brief Disconnects a specific connection by marking it inactive.
-     * @note This function takes the connection by reference to modify the original object.
+     * @brief Manages a fixed-size container of connections and dispatches events to them.
      * @since 1.0.0
      *
-     * Calling this function ensures that the given connection will no longer
-     * be considered active by any signal, effectively preventing its callback
-     * from being invoked on future signal firings.
+     * This class implements a simple but efficient signal-slot event mechanism.
+     * Clients can register multiple callbacks (connections) with this signal,
+     * which will be invoked sequentially in the order they were added when the
+     * signal is fired. Since 1.2.0 connections can also be given a priority,
+     * and higher priorities run first.
      *
-     * @param connection The connection object to disconnect.
-     */
-    template<typename... arguments>
-    void disconnect(connection<arguments...>& connection) {
+     * The container has a fixed maximum capacity defined by `CPP_CONNECTIONS_MAX_CONNECTIONS`.
+     * Attempting to add more connections beyond this limit will fail.
+     *
+     * Signals provide both persistent and one-shot connection registration, forwarding,
+     * and management functions to control and modify connection behavior.
+     *
+     * @tparam arguments Template parameter pack specifying the argument types
+     *                   that will be forwarded to each callback upon firing.
+     */
+    template<typename... arguments>
+    class signal {
+    public:
+        /**
+         * @brief Constructs a new signal instance with all connections initially disconnected.
+         * @since 1.0.0
+         *
+         * The signal starts with no connections and in an active state,
+         * allowing callbacks to be invoked upon firing.
+         *
+         * Since 1.2.0 slots are handed out from a high-water mark and only slots below
+         * it are ever read, so construction does not touch the connection array and
+         * costs the same regardless of `CPP_CONNECTIONS_MAX_CONNECTIONS`.
+         */
+        signal() : active(true), backlog(nullptr), plan(nullptr), ordered(0), queued(0), available(0), touched(0),
+                   shot_head(0), shot_count(0), live(0), stale(0), special(0), firing(0), revision(0), sequenced(0) {
+            for (int i = 0; i < shot_words; ++i) {
+                blocked_shots[i] = 0;
+            }
+        }
+
+        /**
+         * @brief Copy constructor.
+         * @since 1.1.0
+         *
+         * Creates a new signal instance as a copy of another signal.
+         * All internal connection states, callbacks, contexts, and flags
+         * are duplicated, preserving the exact signal state.
+         *
+         * This allows independent copies of signals where connections remain consistent,
+         * without sharing pointers or references. The suspension log of the other signal
+         * is not shared, so a copy of a buffering suspended signal drops events until resumed.
+         * The copy is never frozen, even if the other signal is.
+         *
+         * Since 1.2.0 a copied connection is tracked by the same `trackable` and belongs to the
+         * same `connection_group` as its original, so both are torn down together.
+         *
+         * @param other The signal instance to copy from.
+         */
+        signal(const signal& other) : active(other.active), backlog(nullptr), plan(nullptr), firing(0), revision(0) {
+            copy_connections(other, false);
+            bump_revision();
+        }
+
+        /**
+         * @brief Copy assignment operator.
+         * @since 1.1.0
+         *
+         * Assigns the contents and state of another signal instance to this one.
+         * Existing connections are disconnected and replaced by the copied signal’s connections,
+         * and the active state is updated accordingly. A suspension log is never
+         * shared between signals, so this signal's own log (if any) is kept.
+         *
+         * Self-assignment is safely handled by checking the address before copying.
+         *
+         * @param other The signal instance to copy from.
+         * @return Reference to this signal after assignment.
+         */
+        signal& operator=(const signal& other) {
+            if (this != &other) {
+                active = other.active;
+                disconnect_all();
+                copy_connections(other, false);
+                bump_revision();
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move constructor.
+         * @since 1.1.0
+         *
+         * Moves the state of another signal instance into this one.
+         * The other instance is left in a valid but unspecified state.
+         *
+         * This efficiently transfers ownership of all connection states,
+         * callback pointers, contexts, the active flag, the suspension log and the
+         * dispatch plan without copying.
+         *
+         * Since 1.2.0 the moved connections stay tracked by their `trackable` and stay
+         * members of their `connection_group`, and the other signal is left without connections.
+         *
+         * @param other The signal instance to move from.
+         */
+        signal(signal&& other) noexcept : active(other.active), backlog(other.backlog), plan(other.plan), firing(0), revision(0) {
+            copy_connections(other, true);
+            other.abandon_connections();
+            other.active = false;
+            other.backlog = nullptr;
+            other.plan = nullptr;
+            other.bump_revision();
+            bump_revision();
+        }
+
+        /**
+         * @brief Move assignment operator.
+         * @since 1.1.0
+         *
+         * Moves the state of another signal instance into this one, overwriting
+         * the current state. The other instance is left in a valid but unspecified state.
+         * Existing connections of this signal are disconnected first.
+         *
+         * Self-move assignment is safely handled by checking the address before moving.
+         *
+         * @param other The signal instance to move from.
+         * @return Reference to this signal after assignment.
+         */
+        signal& operator=(signal&& other) noexcept {
+            if (this != &other) {
+                active = other.active;
+                backlog = other.backlog;
+                plan = other.plan;
+                disconnect_all();
+                copy_connections(other, true);
+                other.abandon_connections();
+                other.active = false;
+                other.backlog = nullptr;
+                other.plan = nullptr;
+                other.bump_revision();
+                bump_revision();
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor automatically disconnects all connections managed by this signal.
+         * @since 1.1.0
+         *
+         * Upon destruction, this destructor calls `disconnect_all()` to ensure
+         * no lingering active connections remain, preventing potential callbacks
+         * to destroyed or invalid contexts. Since 1.2.0 it also cancels the fires
+         * scheduled with `fire_after()` and `fire_every()`.
+         */
+        ~signal() {
+            scheduled.sever_all();
+            disconnect_all();
+        }
+
+        /**
+         * @brief Registers a persistent callback function with an associated user context.
+         * @since 1.0.0
+         *
+         * This method takes an available slot from the internal connection array.
+         * If a free slot is found, it activates the connection, stores the callback
+         * function pointer and the user context, and returns a pointer to the new connection.
+         *
+         * Since 1.2.0 the connection is placed into the signal's dispatch order by a binary
+         * search on `priority`: it runs after every connection with a higher or equal priority
+         * and before every connection with a lower one. Connections made while the signal is
+         * firing are first invoked by the next `fire()`.
+         *
+         * If the maximum number of connections has been reached, it returns nullptr.
+         *
+         * @param function Pointer to the callback function to invoke on signal firing.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @param priority Dispatch priority, where higher values run first. Defaults to 0.
+         * @return Pointer to the newly created connection if successful, nullptr if full.
+         */
+        connection<arguments...>* connect(void (*function)(void* context, arguments...), void* context, int priority = 0) {
+            return attach(function, context, false, priority);
+        }
+
+        /**
+         * @brief Registers a one-shot callback function with an associated user context.
+         * @since 1.1.0
+         *
+         * Similar to `connect()`, but the resulting connection will automatically
+         * disconnect itself after the callback is invoked once, ensuring the listener
+         * responds to only a single event.
+         *
+         * Since 1.2.0 one-shot connections with the default priority are kept in a separate
+         * ring of `CPP_CONNECTIONS_MAX_ONE_SHOTS` entries instead of the connection table.
+         * Making one takes the next ring entry, and each `fire()` merges the ring into the
+         * dispatch order by `connection::sequence`, so ring entries run exactly where a table
+         * connection of priority 0 made at the same time would, then releases the run entries
+         * in bulk. High-churn one-shot subscribers therefore never enter the dispatch order,
+         * which stays on the `fire()` fast path, and frozen signals merge the ring into their
+         * dispatch plan the same way. When the ring is full, the connection goes into the table.
+         *
+         * @param function Pointer to the callback function to invoke on signal firing.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @param priority Dispatch priority, where higher values run first. Defaults to 0.
+         * @return Pointer to the new connection if successful, nullptr if full.
+         */
+        connection<arguments...>* once(void (*function)(void* context, arguments...), void* context, int priority = 0) {
+            if (priority == 0 && shot_count < CPP_CONNECTIONS_MAX_ONE_SHOTS &&
+                function != &signal::forward_nested && function != &signal::forward_flattened) {
+                return push_one_shot(function, context);
+            }
+            return attach(function, context, true, priority);
+        }
+
+        /**
+         * @brief Registers a one-shot callback that is disconnected if the signal does not fire before a deadline.
+         * @since 1.2.0
+         *
+         * The connection behaves like one made by `once()`. In addition, a timer on `wheel`
+         * disconnects it and calls `on_timeout` with the same context if it is still connected
+         * when `wheel.tick()` reaches `deadline`. Running or disconnecting the connection cancels
+         * the timer in O(1), so expired waiters never have to be swept out of the signal.
+         *
+         * The connection's callback and context are an internal trampoline and its record in
+         * the timer's payload. `disconnect_by_callback()` and `disconnect_by_context()` look
+         * through them and match the values passed here, but the connection must not be
+         * duplicated onto another signal with `connect_once()`; use the returned handle instead.
+         * Copies of the signal, and signals it is moved into, receive a plain one-shot connection
+         * without the timeout.
+         *
+         * @param function Pointer to the callback function to invoke on signal firing.
+         * @param context User-defined pointer passed to the callback and to `on_timeout`.
+         * @param wheel The wheel driving the timeout, which must outlive the connection.
+         * @param deadline Tick of `wheel` at which the connection times out.
+         * @param on_timeout Called when the connection timed out, or nullptr.
+         * @param priority Dispatch priority, where higher values run first. Defaults to 0.
+         * @return Pointer to the new connection, or nullptr if the signal is full or the wheel has no vacant timer.
+         */
+        connection<arguments...>* once_with_timeout(void (*function)(void* context, arguments...), void* context,
+                                                    timer_wheel& wheel, timer_ticks deadline,
+                                                    void (*on_timeout)(void* context), int priority = 0) {
+            static_assert(sizeof(timeout_record) <= CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES,
+                          "CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES is too small for a timeout");
+
+            timer_wheel::timer* alarm = wheel.acquire();
+            if (!alarm) {
+                return nullptr;
+            }
+
+            timeout_record* record = new (detail::placement_tag(), alarm->payload.bytes) timeout_record;
+            record->callback = function;
+            record->context = context;
+            record->on_timeout = on_timeout;
+            record->wheel = &wheel;
+            record->alarm = alarm;
+            record->handle = once(&signal::timed_once, record, priority);
+            if (!record->handle) {
+                wheel.release(alarm);
+                return nullptr;
+            }
+
+            wheel.arm(alarm, deadline, &signal::expire_timeout, nullptr, record);
+            return record->handle;
+        }
+
+        /**
+         * @brief Sets up forwarding from this signal to another signal.
+         * @since 1.1.0
+         *
+         * This method registers a connection on this signal that, when fired,
+         * will invoke the `fire()` method on the target signal with the same arguments.
+         * This effectively links the two signals so that events propagate from this
+         * signal to the target.
+         *
+         * With `forward_mode::flattened`, the target is not fired recursively; instead
+         * `fire()` on this signal walks the target's subscribers (and those of signals it
+         * forwards to in flattened mode) iteratively, deduplicating repeated subscribers.
+         *
+         * Since 1.2.0 the forwarding graph is checked for cycles, and a connection that
+         * would let an event reach this signal again is refused. If the target reaches more than
+         * `CPP_CONNECTIONS_MAX_FORWARD_SIGNALS` signals, the check cannot tell: nested forwarding
+         * is then accepted as it always was, while flattened forwarding is refused.
+         *
+         * @param target Pointer to the signal instance that should receive forwarded events.
+         * @param mode How events are propagated to the target. Defaults to `forward_mode::nested`.
+         * @return Pointer to the internal connection object responsible for forwarding,
+         *         or nullptr if the signal is full or the connection would create a cycle.
+         */
+        connection<arguments...>* forward_to(signal<arguments...>* target, forward_mode mode = forward_mode::nested) {
+            if (!target || target->forwards_into(this, mode == forward_mode::flattened)) {
+                return nullptr;
+            }
+
+            return connect(
+                mode == forward_mode::flattened ? &signal::forward_flattened : &signal::forward_nested,
+                static_cast<void*>(target)
+            );
+        }
+
+        /**
+         * @brief Disconnects all currently active connections from this signal.
+         * @since 1.1.0
+         *
+         * This method iterates over the entire internal connection array and
+         * marks all active connections as disconnected. After calling this,
+         * the signal will have no listeners and invoking `fire()` will result
+         * in no callbacks being called.
+         */
+        void disconnect_all() {
+            firing++;
+            for (int i = 0; i < touched; ++i) {
+                if (connections[i].connected) {
+                    connections[i].disconnect();
+                }
+            }
+
+            auto every = [](const connection<arguments...>&) {
+                return true;
+            };
+            disconnect_one_shots(every);
+
+            firing--;
+            settle();
+        }
+
+        /**
+         * @brief Disconnects all connections whose callback function pointer matches the given pointer.
+         * @since 1.1.0
+         *
+         * This method searches all active connections and disconnects those
+         * whose callback function pointer is equal to the specified function pointer.
+         * Useful for bulk removing listeners that share the same callback.
+         *
+         * Since 1.2.0 the search is a vectorized scan over the packed callback array (see
+         * `detail::match_pointers()`). Blocked and stale entries hold `skip()` there, so they
+         * are collected as candidates as well and checked against their connection. Connections
+         * made by `once_with_timeout()` hold `timed_once()` and are matched by the user's callback.
+         *
+         * @param callback The callback function pointer to match and disconnect.
+         */
+        void disconnect_by_callback(void (*callback)(void*, arguments...)) {
+            int matches[CPP_CONNECTIONS_MAX_CONNECTIONS];
+            int count = detail::match_pointers(callbacks, ordered, callback, &signal::skip, matches);
+            firing++;
+
+            for (int i = 0; i < count; ++i) {
+                connection<arguments...>& current = connections[order[matches[i]]];
+                if (current.connected && target_callback(current) == callback) {
+                    current.disconnect();
+                }
+            }
+            if (callback != &signal::timed_once) {
+                count = detail::match_pointers(callbacks, ordered, &signal::timed_once, &signal::timed_once, matches);
+                for (int i = 0; i < count; ++i) {
+                    connection<arguments...>& current = connections[order[matches[i]]];
+                    if (current.connected && target_callback(current) == callback) {
+                        current.disconnect();
+                    }
+                }
+            }
+            for (int at = ordered; at < ordered + queued; ++at) {
+                connection<arguments...>& current = connections[order[at]];
+                if (current.connected && target_callback(current) == callback) {
+                    current.disconnect();
+                }
+            }
+
+            auto same_callback = [callback](const connection<arguments...>& current) {
+                return target_callback(current) == callback;
+            };
+            disconnect_one_shots(same_callback);
+
+            firing--;
+            settle();
+        }
+
+        /**
+         * @brief Disconnects all connections whose user context pointer matches the given pointer.
+         * @since 1.1.0
+         *
+         * This method iterates through all active connections and disconnects
+         * those whose context pointer matches the provided context.
+         * This is helpful for removing all listeners associated with a particular object or context.
+         * Connections made by `once_with_timeout()` are matched by the user's context.
+         *
+         * @param context The user-defined context pointer to match and disconnect.
+         */
+        void disconnect_by_context(void* context) {
+            int matches[CPP_CONNECTIONS_MAX_CONNECTIONS];
+            int count = detail::match_pointers(static_cast<void* const*>(contexts), ordered, context, context, matches);
+            firing++;
+
+            for (int i = 0; i < count; ++i) {
+                connection<arguments...>& current = connections[order[matches[i]]];
+                if (current.connected && target_context(current) == context) {
+                    current.disconnect();
+                }
+            }
+            count = detail::match_pointers(callbacks, ordered, &signal::timed_once, &signal::skip, matches);
+            for (int i = 0; i < count; ++i) {
+                connection<arguments...>& current = connections[order[matches[i]]];
+                if (current.connected && current.callback == &signal::timed_once && target_context(current) == context) {
+                    current.disconnect();
+                }
+            }
+            for (int at = ordered; at < ordered + queued; ++at) {
+                connection<arguments...>& current = connections[order[at]];
+                if (current.connected && target_context(current) == context) {
+                    current.disconnect();
+                }
+            }
+
+            auto same_context = [context](const connection<arguments...>& current) {
+                return target_context(current) == context;
+            };
+            disconnect_one_shots(same_context);
+
+            firing--;
+            settle();
+        }
+
+        /**
+         * @brief Suspends the signal, preventing any callbacks from being invoked during `fire()`.
+         * @since 1.1.0
+         *
+         * When a signal is suspended, it maintains its list of active connections,
+         * but temporarily disables callback invocation. This allows pausing event
+         * dispatch without disconnecting or removing listeners.
+         *
+         * Events fired while suspended this way are discarded.
+         */
+        void suspend() {
+            active = false;
+            backlog = nullptr;
+            bump_revision();
+        }
+
+        /**
+         * @brief Suspends the signal and buffers every event fired while suspended into a log.
+         * @since 1.2.0
+         *
+         * Instead of dropping events, `fire()` records its arguments into the given
+         * `event_log`, which folds them together according to its coalescing policy.
+         * The next `resume()` replays the log in one batch, so a bulk import fired
+         * thousands of times can reach subscribers as a single event with `keep_last`.
+         *
+         * Events that do not fit into an `accumulate` log are discarded.
+         * The log must outlive the suspension.
+         *
+         * @param log The log receiving events while suspended, or nullptr to discard them.
+         */
+        void suspend(event_log<arguments...>* log) {
+            active = false;
+            backlog = log;
+            bump_revision();
+        }
+
+        /**
+         * @brief Resumes the signal, allowing callbacks to be invoked normally during `fire()`.
+         * @since 1.1.0
+         *
+         * This re-enables callback dispatch after a prior suspension, restoring
+         * normal signal behavior without needing to reconnect listeners.
+         *
+         * If the signal was suspended with an `event_log`, the events buffered in it
+         * are replayed through `fire()` before this function returns.
+         */
+        void resume() {
+            active = true;
+            bump_revision();
+
+            if (backlog) {
+                event_log<arguments...>* log = backlog;
+                backlog = nullptr;
+                log->replay(*this);
+            }
+        }
+
+        /**
+         * @brief Fires the signal, invoking all active callbacks with the provided arguments if active.
+         * @since 1.0.0
+         *
+         * This function iterates through all registered connections and invokes
+         * the callbacks for each connection that is currently active and connected.
+         * One-shot connections are automatically disconnected immediately after invocation.
+         *
+         * If the signal is suspended (not active), this function returns immediately
+         * without invoking any callbacks. When the suspension has an `event_log` attached,
+         * the arguments are recorded into it for replay by `resume()`.
+         *
+         * A frozen signal (see `freeze()`) runs its compiled `dispatch_plan` instead,
+         * recompiling it first if the connection topology changed since it was built.
+         *
+         * Since 1.2.0, while no one-shot or flattened forwarding connection is registered,
+         * dispatch is a single loop over densely packed (callback, context) arrays.
+         * It has no per-connection checks, because connections disconnected mid-fire
+         * have their callback replaced by a no-op until the dispatch order is compacted.
+         *
+         * @param args The argument pack forwarded to each callback function.
+         */
+        void fire(arguments... args) {
+            if (!active) {
+                if (backlog) {
+                    backlog->record(args...);
+                }
+                return;
+            }
+
+            firing++;
+
+            bool planned = false;
+            if (plan) {
+                bool current = plan->compiled && plan->current();
+                if (!current && plan->running == 0) {
+                    compile_plan();
+                    current = true;
+                }
+                planned = current && plan->usable;
+            }
+
+            if (planned) {
+                fire_plan(args...);
+            } else if (special == 0) {
+                int count = ordered;
+                int shots = shot_count;
+                int at = 0;
+                for (int next = 0; next < shots; ++next) {
+                    connection<arguments...>& shot = one_shots[(shot_head + next) % CPP_CONNECTIONS_MAX_ONE_SHOTS];
+                    for (int stop = shot_position(shot, at); at < stop; ++at) {
+                        callbacks[at](contexts[at], args...);
+                    }
+
+                    if (shot.connected && shot.callback && !shot.muted()) {
+                        shot.callback(shot.context, args...);
+                        expire_one_shot(shot);
+                    }
+                }
+                for (; at < count; ++at) {
+                    callbacks[at](contexts[at], args...);
+                }
+            } else {
+                int count = ordered;
+                int shots = shot_count;
+                int next = 0;
+                for (int at = 0; at < count; ++at) {
+                    connection<arguments...>& current = connections[order[at]];
+                    if (next < shots) {
+                        run_one_shots(&current, next, shots, args...);
+                    }
+
+                    if (current.connected && current.callback && !current.muted()) {
+                        if (current.callback == &signal::forward_flattened) {
+                            fire_flattened(at, next, shots, args...);
+                            next = shots;
+                            break;
+                        }
+
+                        current.callback(current.context, args...);
+
+                        if (current.once) {
+                            current.disconnect();
+                        }
+                    }
+                }
+                run_one_shots(nullptr, next, shots, args...);
+            }
+
+            firing--;
+            settle();
+        }
+
+        /**
+         * @brief Callable handed to the producer of `fire_lazy()` to fire the signal with the built arguments.
+         * @since 1.2.0
+         */
+        struct emitter {
+            /**
+             * @brief Fires the signal the emitter belongs to.
+             * @since 1.2.0
+             *
+             * @param args The argument pack forwarded to each callback function.
+             */
+            void operator()(arguments... args) const {
+                target->fire(args...);
+            }
+
+            /**
+             * @brief The signal to fire.
+             * @since 1.2.0
+             */
+            signal* target;
+        };
+
+        /**
+         * @brief Fires the signal with arguments built on demand, only if anything would observe them.
+         * @since 1.2.0
+         *
+         * The producer is not called at all when the signal has no connections, or when it
+         * is suspended without an `event_log` to record into. Otherwise it is called once with
+         * an `emitter`, which it invokes with the arguments it built:
+         * @code
+         * moved.fire_lazy([&](const signal<const snapshot&>::emitter& emit) {
+         *     emit(take_snapshot());
+         * });
+         * @endcode
+         *
+         * This keeps payload formatting and snapshots out of the cost of idle instrumentation
+         * signals; the check itself is two loads.
+         *
+         * @param producer Object callable as `void(const emitter&)`.
+         * @return `true` if the producer was called, `false` if it was skipped.
+         */
+        template<typename producer_type>
+        bool fire_lazy(const producer_type& producer) {
+            if (active ? live == 0 : !backlog) {
+                return false;
+            }
+
+            const emitter emit = { this };
+            producer(emit);
+            return true;
+        }
+
+        /**
+         * @brief Fires the signal with the given arguments once `delay` ticks of `wheel` have passed.
+         * @since 1.2.0
+         *
+         * The arguments are copied into the payload of a timer of the wheel (see `detail::argument_pack`),
+         * so scheduling never allocates; together with the bookkeeping they must fit into
+         * `CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES`. The fire happens inside `wheel.tick()`.
+         *
+         * Scheduled fires belong to this signal object: destroying the signal or calling
+         * `cancel_scheduled()` cancels them, and they are not carried over by copies or moves.
+         *
+         * @param wheel The wheel to schedule on, which must outlive the scheduled fire.
+         * @param delay Number of ticks from the wheel's current time.
+         * @param args The arguments to fire with.
+         * @return Handle to pass to `wheel.cancel()`, or nullptr if the wheel has no vacant timer.
+         */
+        timer_wheel::timer* fire_after(timer_wheel& wheel, timer_ticks delay, arguments... args) {
+            return schedule_fire(wheel, delay, false, args...);
+        }
+
+        /**
+         * @brief Fires the signal with the given arguments every `interval` ticks of `wheel`.
+         * @since 1.2.0
+         *
+         * Works like `fire_after()`, except that the timer is re-armed for the next period
+         * before each fire, so the handle stays valid until the schedule is cancelled with
+         * `wheel.cancel()`, `cancel_scheduled()` or by destroying the signal. An interval of
+         * zero fires on every tick.
+         *
+         * @param wheel The wheel to schedule on, which must outlive the scheduled fire.
+         * @param interval Number of ticks between fires, starting from the wheel's current time.
+         * @param args The arguments to fire with.
+         * @return Handle to pass to `wheel.cancel()`, or nullptr if the wheel has no vacant timer.
+         */
+        timer_wheel::timer* fire_every(timer_wheel& wheel, timer_ticks interval, arguments... args) {
+            return schedule_fire(wheel, interval, true, args...);
+        }
+
+        /**
+         * @brief Cancels every fire scheduled on this signal with `fire_after()` or `fire_every()`.
+         * @since 1.2.0
+         */
+        void cancel_scheduled() {
+            scheduled.sever_all();
+        }
+
+        /**
+         * @brief Fires the signal to the subscribers whose tags share at least one bit with `mask`.
+         * @since 1.2.0
+         *
+         * Selection is a branch-free pass over the packed tag array that collects the
+         * matching dispatch positions, which the compiler can vectorize; only the selected
+         * subscribers are then visited, in dispatch order. Subscribers set their categories
+         * with `connection::set_tags()` and connections without tags are never selected.
+         *
+         * Forwarding connections that match fire their target in full. A frozen signal's
+         * dispatch plan is not used, and events fired while suspended are discarded.
+         * Matching entries of the one-shot ring run and expire; the others stay connected.
+         *
+         * @param mask The categories to reach.
+         * @param args The argument pack forwarded to each selected callback function.
+         */
+        void fire_masked(tag_mask mask, arguments... args) {
+            if (!active) {
+                return;
+            }
+
+            int selected[CPP_CONNECTIONS_MAX_CONNECTIONS];
+            int count = 0;
+            for (int at = 0; at < ordered; ++at) {
+                selected[count] = at;
+                count += (tags[at] & mask) != 0;
+            }
+
+            auto dispatch = [&](int from, int to) {
+                if (special == 0) {
+                    for (int i = from; i < to; ++i) {
+                        callbacks[selected[i]](contexts[selected[i]], args...);
+                    }
+                    return;
+                }
+
+                for (int i = from; i < to; ++i) {
+                    int at = selected[i];
+                    connection<arguments...>& current = connections[order[at]];
+                    if (current.connected && !current.muted()) {
+                        callbacks[at](contexts[at], args...);
+
+                        if (current.once) {
+                            current.disconnect();
+                        }
+                    }
+                }
+            };
+
+            firing++;
+            int shots = shot_count;
+            int done = 0;
+            for (int next = 0; next < shots; ++next) {
+                connection<arguments...>& shot = one_shots[(shot_head + next) % CPP_CONNECTIONS_MAX_ONE_SHOTS];
+                if (!(shot.tags() & mask)) {
+                    continue;
+                }
+
+                int boundary = shot_position(shot, done < count ? selected[done] : ordered);
+                int stop = done;
+                while (stop < count && selected[stop] < boundary) {
+                    stop++;
+                }
+                dispatch(done, stop);
+                done = stop;
+
+                if (shot.connected && shot.callback && !shot.muted()) {
+                    shot.callback(shot.context, args...);
+                    expire_one_shot(shot);
+                }
+            }
+            dispatch(done, count);
+
+            firing--;
+            settle();
+        }
+
+        /**
+         * @brief Freezes the signal, compiling its forwarding graph into the given dispatch plan.
+         * @since 1.2.0
+         *
+         * The plan flattens this signal's subscribers and those reached through
+         * `forward_mode::flattened` forwarding into one ordered array of (callback, context)
+         * pairs, so `fire()` becomes a single linear loop with no forwarding walk.
+         * Nested forwarding connections stay ordinary callbacks in the plan.
+         *
+         * Connecting to, suspending or resuming this signal or one of the signals the plan
+         * flattened, or removing one of their flattened forwarding connections, invalidates the
+         * plan, which is then recompiled lazily by the next `fire()`. Other signals do not affect
+         * it, and neither do disconnections and one-shot expiry, which the plan skips over.
+         * Freezing therefore pays off for graphs that are wired once and rarely change.
+         *
+         * @param target_plan The plan to compile into, which must outlive the freeze and
+         *                    must not be shared with another signal. nullptr thaws the signal.
+         */
+        void freeze(dispatch_plan<arguments...>* target_plan) {
+            plan = target_plan;
+            if (plan) {
+                plan->running = 0;
+                compile_plan();
+            }
+        }
+
+        /**
+         * @brief Detaches the dispatch plan so `fire()` walks the connections directly again.
+         * @since 1.2.0
+         */
+        void thaw() {
+            plan = nullptr;
+        }
+
+        /**
+         * @brief Returns whether the signal currently dispatches through a `dispatch_plan`.
+         * @since 1.2.0
+         */
+        bool frozen() const {
+            return plan != nullptr;
+        }
+
+        /**
+         * @brief Returns the compile-time maximum number of connections this signal can manage.
+         * @since 1.1.0
+         *
+         * This value reflects the fixed-size capacity of the internal connections array,
+         * as defined by the macro `CPP_CONNECTIONS_MAX_CONNECTIONS`.
+         *
+         * @return The maximum number of simultaneous connections supported by this signal.
+         */
+        int max_connections() const {
+            return CPP_CONNECTIONS_MAX_CONNECTIONS;
+        }
+
+        /**
+         * @brief Returns the current number of active connections registered to this signal.
+         * @since 1.1.0
+         *
+         * Counts how many connections are marked as connected (active and not disconnected).
+         *
+         * Since 1.2.0 the count is maintained as connections are made and disconnected
+         * (including one-shot connections expiring during `fire()`), so this is a single load.
+         *
+         * @return The count of currently connected callbacks.
+         */
+        unsigned int connection_count() const {
+            return static_cast<unsigned int>(live);
+        }
+
+        /**
+         * @brief Returns whether no connection is registered to this signal.
+         * @since 1.2.0
+         *
+         * Cheap enough to guard the construction of expensive event payloads:
+         * @code
+         * if (!changed.empty()) {
+         *     changed.fire(take_snapshot());
+         * }
+         * @endcode
+         *
+         * @return True if `connection_count()` is zero.
+         */
+        bool empty() const {
+            return live == 0;
+        }
+    private:
+        friend struct connection<arguments...>;
+        friend class connection_group;
+        friend class dispatch_plan<arguments...>;
+
+        /**
+         * @brief Gives the signal a new revision, so the plans that depend on it are recompiled.
+         * @since 1.2.0
+         */
+        void bump_revision() {
+            revision = ++detail::topology<arguments...>::revision;
+        }
+
+        /**
+         * @brief Number of 32-bit words in `blocked_slots`.
+         * @since 1.2.0
+         */
+        static const int blocked_words = (CPP_CONNECTIONS_MAX_CONNECTIONS + 31) / 32;
+
+        /**
+         * @brief Number of 32-bit words in `blocked_shots`.
+         * @since 1.2.0
+         */
+        static const int shot_words = (CPP_CONNECTIONS_MAX_ONE_SHOTS + 31) / 32;
+
+        template<typename result_type, typename... signature>
+        friend class collecting_signal;
+
+        template<typename... signature>
+        friend class incremental_signal;
+
+        /**
+         * @brief Starts an incremental dispatch pass over the connections made so far.
+         * @since 1.2.0
+         *
+         * The pass holds nothing of the signal between calls to `run_pass()`, so the signal
+         * compacts, connects and fires as usual in the meantime.
+         *
+         * @param cursor The cursor to initialize.
+         */
+        void open_pass(detail::dispatch_cursor& cursor) const {
+            cursor.priority = 0;
+            cursor.sequence = 0;
+            cursor.bound = sequenced;
+            cursor.started = false;
+        }
+
+        /**
+         * @brief Returns whether an incremental dispatch pass already went past `handle`.
+         * @since 1.2.0
+         */
+        static bool passed(const connection<arguments...>& handle, const detail::dispatch_cursor& cursor) {
+            return cursor.started && (handle.priority > cursor.priority ||
+                                      (handle.priority == cursor.priority && handle.sequence <= cursor.sequence));
+        }
+
+        /**
+         * @brief Runs the steps of an incremental dispatch pass until the budget is used.
+         * @since 1.2.0
+         *
+         * Finds its place again by a binary search over the dispatch order, then merges the
+         * one-shot ring in as `fire()` does. Connections made after the pass began are passed
+         * over, and so are connections that are disconnected or muted by the time they are
+         * reached, without counting against the budget. One-shot connections are disconnected
+         * after they ran, and forwarding connections fire their target in full.
+         *
+         * @param cursor The pass to continue, which must be open.
+         * @param budget Limit of this call; zero limits mean unlimited.
+         * @param args The argument pack forwarded to each callback function.
+         * @return `true` if the pass reached its end.
+         */
+        bool run_pass(detail::dispatch_cursor& cursor, const dispatch_budget& budget, arguments... args) {
+            firing++;
+
+            int count = ordered;
+            int shots = shot_count;
+            int low = 0;
+            int high = count;
+            while (low < high) {
+                int middle = low + (high - low) / 2;
+                if (passed(connections[order[middle]], cursor)) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            int at = low;
+            int next = 0;
+            while (next < shots && passed(one_shots[(shot_head + next) % CPP_CONNECTIONS_MAX_ONE_SHOTS], cursor)) {
+                next++;
+            }
+
+            unsigned int invoked = 0;
+            while (at < count || next < shots) {
+                bool shot = next < shots &&
+                            (at == count ||
+                             shot_precedes(one_shots[(shot_head + next) % CPP_CONNECTIONS_MAX_ONE_SHOTS], connections[order[at]]));
+                connection<arguments...>* current = shot ? &one_shots[(shot_head + next++) % CPP_CONNECTIONS_MAX_ONE_SHOTS]
+                                                         : &connections[order[at++]];
+                cursor.priority = current->priority;
+                cursor.sequence = current->sequence;
+                cursor.started = true;
+
+                if (current->sequence >= cursor.bound || !current->connected || !current->callback || current->muted()) {
+                    continue;
+                }
+
+                current->callback(current->context, args...);
+                if (shot) {
+                    expire_one_shot(*current);
+                } else if (current->once) {
+                    current->disconnect();
+                }
+
+                invoked++;
+                if (budget.callbacks != 0 && invoked >= budget.callbacks) {
+                    break;
+                }
+                if (budget.clock && budget.clock->now(budget.clock->user) >= budget.deadline) {
+                    break;
+                }
+            }
+            bool finished = at == count && next == shots;
+
+            firing--;
+            settle();
+            return finished;
+        }
+
+        /**
+         * @brief Visits every live connection in dispatch order until the visitor asks to stop.
+         * @since 1.2.0
+         *
+         * Used by adaptors that store differently typed callbacks in a signal's connection
+         * table. One-shot connections are disconnected after they were visited, and the
+         * one-shot ring is visited at the same point `fire()` runs it.
+         *
+         * @param visitor Called as `bool(connection&)`; returning `false` stops the iteration.
+         * @return `true` if every connection was visited, `false` if the visitor stopped early.
+         */
+        template<typename visitor_function>
+        bool visit(visitor_function& visitor) {
+            bool completed = true;
+            int count = ordered;
+            int shots = shot_count;
+            int next = 0;
+            auto visit_shot = [&](connection<arguments...>& current) -> bool {
+                bool proceed = visitor(current);
+                expire_one_shot(current);
+                return proceed;
+            };
+            firing++;
+
+            for (int at = 0; at < count; ++at) {
+                connection<arguments...>& current = connections[order[at]];
+                if (next < shots && !visit_one_shots(&current, next, shots, visit_shot)) {
+                    completed = false;
+                    break;
+                }
+
+                if (current.connected && current.callback && !current.muted()) {
+                    bool proceed = visitor(current);
+
+                    if (current.once) {
+                        current.disconnect();
+                    }
+                    if (!proceed) {
+                        completed = false;
+                        break;
+                    }
+                }
+            }
+            if (completed) {
+                completed = visit_one_shots(nullptr, next, shots, visit_shot);
+            }
+
+            firing--;
+            settle();
+            return completed;
+        }
+
+        /**
+         * @brief Takes a vacant slot and places it into the dispatch order.
+         * @since 1.2.0
+         *
+         * Shared by `connect()` and `once()`. While the signal is firing the slot is queued
+         * behind the dispatch order instead, so positions the running loop still has to
+         * visit do not move, and `settle()` sorts it in once the outermost `fire()` returns.
+         *
+         * @param function Pointer to the callback function.
+         * @param context User-defined pointer passed to the callback.
+         * @param once Whether the connection disconnects itself after its first invocation.
+         * @param priority Dispatch priority, where higher values run first.
+         * @return Pointer to the new connection, or nullptr if no slot is available.
+         */
+        connection<arguments...>* attach(void (*function)(void*, arguments...), void* context, bool once, int priority) {
+            settle();
+
+            int slot;
+            if (available > 0) {
+                slot = vacant[--available];
+                blocked_slots[slot / 32] &= ~(1u << (slot % 32));
+            } else if (touched < CPP_CONNECTIONS_MAX_CONNECTIONS) {
+                slot = touched++;
+                if (slot % 32 == 0) {
+                    blocked_slots[slot / 32] = 0;
+                }
+            } else {
+                return nullptr;
+            }
+
+            connection<arguments...>& added = connections[slot];
+            added.connected = true;
+            added.once = once;
+            added.callback = function;
+            added.context = context;
+            added.priority = priority;
+            added.sequence = sequenced++;
+            added.owner = this;
+            live++;
+            added.links = nullptr;
+            position[slot] = -1;
+
+            if (firing > 0) {
+                order[ordered + queued++] = slot;
+            } else {
+                insert(slot);
+            }
+
+            bump_revision();
+            return &added;
+        }
+
+        /**
+         * @brief Inserts a slot into the sorted dispatch order.
+         * @since 1.2.0
+         *
+         * The position is found by a binary search for the first entry with a lower priority,
+         * which keeps connections of equal priority in insertion order. Stale entries keep
+         * their priority until they are purged, so the order stays sorted around them.
+         * The dispatch arrays are shifted along with the order.
+         *
+         * @param slot Index of the connection to insert.
+         */
+        void insert(int slot) {
+            connection<arguments...>& added = connections[slot];
+            int priority = added.priority;
+            int low = 0;
+            int high = ordered;
+
+            while (low < high) {
+                int middle = low + (high - low) / 2;
+                if (connections[order[middle]].priority >= priority) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+
+            for (int at = ordered; at > low; --at) {
+                place(at, order[at - 1]);
+            }
+            order[low] = slot;
+            callbacks[low] = added.callback && !is_blocked(&added) ? added.callback : &signal::skip;
+            contexts[low] = added.context;
+            tags[low] = added.tags();
+            position[slot] = low;
+            ordered++;
+
+            if (needs_inspection(added)) {
+                special++;
+            }
+        }
+
+        /**
+         * @brief A fire scheduled by `fire_after()` or `fire_every()`, kept in its timer's payload.
+         * @since 1.2.0
+         */
+        struct scheduled_fire {
+            detail::track_link link;
+            signal* target;
+            timer_wheel* wheel;
+            timer_wheel::timer* alarm;
+            timer_ticks interval;
+            bool periodic;
+            detail::argument_pack<arguments...> values;
+        };
+
+        /**
+         * @brief Stores the arguments in a timer of `wheel` and schedules it, see `fire_after()`.
+         * @since 1.2.0
+         */
+        timer_wheel::timer* schedule_fire(timer_wheel& wheel, timer_ticks delay, bool periodic, arguments... args) {
+            static_assert(sizeof(scheduled_fire) <= CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES,
+                          "CPP_CONNECTIONS_TIMER_PAYLOAD_BYTES is too small for the arguments of this signal");
+
+            timer_wheel::timer* alarm = wheel.acquire();
+            if (!alarm) {
+                return nullptr;
+            }
+
+            scheduled_fire* record = new (detail::placement_tag(), alarm->payload.bytes) scheduled_fire;
+            record->link.previous = nullptr;
+            record->target = this;
+            record->wheel = &wheel;
+            record->alarm = alarm;
+            record->interval = delay;
+            record->periodic = periodic;
+            record->values.store(args...);
+            scheduled.push(record->link, record, &signal::sever_scheduled);
+
+            wheel.arm(alarm, wheel.now() + delay, &signal::fire_scheduled, &signal::destroy_scheduled, record);
+            return alarm;
+        }
+
+        /**
+         * @brief Timer callback of a scheduled fire.
+         * @since 1.2.0
+         *
+         * Periodic fires re-arm their timer first, so a subscriber cancelling the
+         * schedule from inside the fire stops it for good.
+         */
+        static void fire_scheduled(void* context) {
+            scheduled_fire* record = static_cast<scheduled_fire*>(context);
+            if (record->periodic) {
+                timer_wheel* wheel = record->wheel;
+                wheel->arm(record->alarm, wheel->now() + record->interval, &signal::fire_scheduled, &signal::destroy_scheduled, record);
+            }
+
+            record->values.fire_into(*record->target);
+        }
+
+        /**
+         * @brief Releases a scheduled fire, unlinking it from its signal.
+         * @since 1.2.0
+         */
+        static void destroy_scheduled(void* context) {
+            scheduled_fire* record = static_cast<scheduled_fire*>(context);
+            if (record->link.previous) {
+                detail::unlink(record->link);
+            }
+            record->~scheduled_fire();
+        }
+
+        /**
+         * @brief Cancels a scheduled fire on behalf of `cancel_scheduled()`.
+         * @since 1.2.0
+         */
+        static void sever_scheduled(void* subject) {
+            scheduled_fire* record = static_cast<scheduled_fire*>(subject);
+            detail::unlink(record->link);
+            record->wheel->cancel(record->alarm);
+        }
+
+        /**
+         * @brief Bookkeeping of a connection made by `once_with_timeout()`, kept in its timer's payload.
+         * @since 1.2.0
+         */
+        struct timeout_record {
+            void (*callback)(void* context, arguments...);
+            void* context;
+            void (*on_timeout)(void* context);
+            timer_wheel* wheel;
+            timer_wheel::timer* alarm;
+            connection<arguments...>* handle;
+        };
+
+        /**
+         * @brief Callback of connections made by `once_with_timeout()`, forwarding to the user's callback.
+         * @since 1.2.0
+         *
+         * The timer is cancelled when the connection expires right after, see `cancel_timeout()`.
+         */
+        static void timed_once(void* context, arguments... args) {
+            timeout_record* record = static_cast<timeout_record*>(context);
+            record->callback(record->context, args...);
+        }
+
+        /**
+         * @brief Returns the callback a connection was made with, looking through `timed_once()`.
+         * @since 1.2.0
+         *
+         * @param handle The connection to inspect.
+         * @return The user's callback for connections made by `once_with_timeout()`, otherwise the connection's callback.
+         */
+        static void (*target_callback(const connection<arguments...>& handle))(void*, arguments...) {
+            if (handle.callback == &signal::timed_once) {
+                return static_cast<const timeout_record*>(handle.context)->callback;
+            }
+            return handle.callback;
+        }
+
+        /**
+         * @brief Returns the context a connection was made with, looking through `timed_once()`.
+         * @since 1.2.0
+         *
+         * @param handle The connection to inspect.
+         * @return The user's context for connections made by `once_with_timeout()`, otherwise the connection's context.
+         */
+        static void* target_context(const connection<arguments...>& handle) {
+            if (handle.callback == &signal::timed_once) {
+                return static_cast<const timeout_record*>(handle.context)->context;
+            }
+            return handle.context;
+        }
+
+        /**
+         * @brief Timer callback disconnecting a connection made by `once_with_timeout()` that timed out.
+         * @since 1.2.0
+         *
+         * A pending timer implies a connected connection, since every disconnection cancels it.
+         */
+        static void expire_timeout(void* context) {
+            timeout_record* record = static_cast<timeout_record*>(context);
+            void (*on_timeout)(void*) = record->on_timeout;
+            void* user_context = record->context;
+
+            record->handle->disconnect();
+            if (on_timeout) {
+                on_timeout(user_context);
+            }
+        }
+
+        /**
+         * @brief Cancels the timer of a connection made by `once_with_timeout()` that was disconnected.
+         * @since 1.2.0
+         *
+         * Does nothing while the timer itself is expiring, in which case the wheel releases it.
+         */
+        static void cancel_timeout(const connection<arguments...>& handle) {
+            timeout_record* record = static_cast<timeout_record*>(handle.context);
+            record->wheel->cancel(record->alarm);
+        }
+
+        /**
+         * @brief Takes the next entry of the one-shot ring for a new one-shot connection.
+         * @since 1.2.0
+         *
+         * The ring is not part of the dispatch order, so unlike `attach()` this neither
+         * moves dispatch entries nor invalidates dispatch plans.
+         *
+         * @param function Pointer to the callback function.
+         * @param context User-defined pointer passed to the callback.
+         * @return Pointer to the new connection.
+         */
+        connection<arguments...>* push_one_shot(void (*function)(void*, arguments...), void* context) {
+            int shot = (shot_head + shot_count++) % CPP_CONNECTIONS_MAX_ONE_SHOTS;
+            blocked_shots[shot / 32] &= ~(1u << (shot % 32));
+
+            connection<arguments...>& added = one_shots[shot];
+            added.connected = true;
+            added.once = true;
+            added.callback = function;
+            added.context = context;
+            added.priority = 0;
+            added.sequence = sequenced++;
+            added.owner = this;
+            added.links = nullptr;
+            live++;
+            return &added;
+        }
+
+        /**
+         * @brief Returns the index of a connection in the one-shot ring, or -1 if it is not stored there.
+         * @since 1.2.0
+         */
+        int one_shot_index(const connection<arguments...>* handle) const {
+            detail::size_type offset = reinterpret_cast<detail::size_type>(handle) - reinterpret_cast<detail::size_type>(one_shots);
+            if (offset >= sizeof(one_shots)) {
+                return -1;
+            }
+            return static_cast<int>(offset / sizeof(connection<arguments...>));
+        }
+
+        /**
+         * @brief Returns whether the one-shot ring entry `shot` runs before the listed connection `handle`.
+         * @since 1.2.0
+         *
+         * Ring entries have priority 0, so they run after every connection with a higher priority,
+         * before every connection with a lower one and in order of `connection::sequence` among
+         * connections of priority 0.
+         */
+        static bool shot_precedes(const connection<arguments...>& shot, const connection<arguments...>& handle) {
+            return handle.priority < 0 || (handle.priority == 0 && handle.sequence > shot.sequence);
+        }
+
+        /**
+         * @brief Returns the first dispatch position from `from` on whose connection runs after the ring entry `shot`.
+         * @since 1.2.0
+         */
+        int shot_position(const connection<arguments...>& shot, int from) const {
+            int low = from;
+            int high = ordered;
+
+            while (low < high) {
+                int middle = low + (high - low) / 2;
+                if (shot_precedes(shot, connections[order[middle]])) {
+                    high = middle;
+                } else {
+                    low = middle + 1;
+                }
+            }
+            return low;
+        }
+
+        /**
+         * @brief Visits the entries of the one-shot ring from `next` up to `count` that run before `before`.
+         * @since 1.2.0
+         *
+         * Dispatch loops call this ahead of each listed connection, which merges the ring into
+         * the dispatch order; with `before` null every remaining entry is visited. `next` is
+         * advanced past the entries handled, and entries that are disconnected or muted are
+         * passed over. Entries added by the visitor are beyond `count` and are left for the next
+         * dispatch. The visitor is responsible for expiring the entries it ran, see `expire_one_shot()`.
+         *
+         * Must be called while the signal counts as firing, so the ring does not move.
+         *
+         * @param before The listed connection about to be dispatched, or nullptr.
+         * @param next Index of the first ring entry not handled yet, relative to `shot_head`.
+         * @param count Number of ring entries to consider, usually `shot_count` when the dispatch began.
+         * @param visitor Called as `bool(connection&)`; returning `false` stops the iteration.
+         * @return `true` unless the visitor stopped early.
+         */
+        template<typename visitor_function>
+        bool visit_one_shots(const connection<arguments...>* before, int& next, int count, visitor_function& visitor) {
+            while (next < count) {
+                connection<arguments...>& current = one_shots[(shot_head + next) % CPP_CONNECTIONS_MAX_ONE_SHOTS];
+                if (before && !shot_precedes(current, *before)) {
+                    break;
+                }
+
+                next++;
+                if (current.connected && current.callback && !current.muted() && !visitor(current)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Runs and expires the entries of the one-shot ring from `next` up to `count` that run before `before`.
+         * @since 1.2.0
+         *
+         * See `visit_one_shots()`, including the requirement to be firing.
+         *
+         * @param before The listed connection about to be dispatched, or nullptr for every remaining entry.
+         * @param next Index of the first ring entry not run yet, relative to `shot_head`.
+         * @param count Number of ring entries to consider, usually `shot_count` when the dispatch began.
+         * @param args The argument pack forwarded to each callback function.
+         */
+        void run_one_shots(const connection<arguments...>* before, int& next, int count, arguments... args) {
+            if (next == count) {
+                return;
+            }
+
+            auto invoke = [&](connection<arguments...>& current) -> bool {
+                current.callback(current.context, args...);
+                expire_one_shot(current);
+                return true;
+            };
+            visit_one_shots(before, next, count, invoke);
+        }
+
+        /**
+         * @brief Disconnects a one-shot ring entry after it ran.
+         * @since 1.2.0
+         *
+         * Unlike `connection::disconnect()` this does not invalidate dispatch plans,
+         * since plans never contain ring entries. The entry itself is released by `settle()`.
+         */
+        void expire_one_shot(connection<arguments...>& handle) {
+            if (!handle.connected) {
+                return;
+            }
+
+            handle.connected = false;
+            handle.release_links();
+            if (handle.callback == &signal::timed_once) {
+                cancel_timeout(handle);
+            }
+            live--;
+        }
+
+        /**
+         * @brief Disconnects the connected entries of the one-shot ring selected by `matches`.
+         * @since 1.2.0
+         *
+         * Must be called while the signal counts as firing, so the ring does not move.
+         *
+         * @param matches Called as `bool(const connection&)`.
+         */
+        template<typename predicate_function>
+        void disconnect_one_shots(predicate_function& matches) {
+            for (int i = 0; i < shot_count; ++i) {
+                connection<arguments...>& current = one_shots[(shot_head + i) % CPP_CONNECTIONS_MAX_ONE_SHOTS];
+                if (current.connected && matches(current)) {
+                    current.disconnect();
+                }
+            }
+        }
+
+        /**
+         * @brief Moves the dispatch entry of a slot to another position.
+         * @since 1.2.0
+         *
+         * @param at The position to write.
+         * @param slot Index of the connection whose entry is moved, which must currently be listed.
+         */
+        void place(int at, int slot) {
+            int from = position[slot];
+            order[at] = slot;
+            callbacks[at] = callbacks[from];
+            contexts[at] = contexts[from];
+            tags[at] = tags[from];
+            position[slot] = at;
+        }
+
+        /**
+         * @brief Notifies the signal that one of its connections was disconnected.
+         * @since 1.2.0
+         *
+         * Called by `connection::disconnect()`. When the signal is idle, the entry is removed
+         * right away and the entries behind it move up, keeping the dispatch arrays dense. While
+         * it is firing, the entry's callback is replaced by a no-op so the running loop stays
+         * valid, and the hole is compacted by the `settle()` after the outermost `fire()`.
+         * Entries of the one-shot ring are never listed and are released by `settle()`.
+         *
+         * @param handle The connection that was disconnected.
+         */
+        void release(connection<arguments...>* handle) {
+            live--;
+            if (handle->callback == &signal::timed_once) {
+                cancel_timeout(*handle);
+            }
+            if (one_shot_index(handle) >= 0) {
+                settle();
+                return;
+            }
+
+            int slot = static_cast<int>(handle - connections);
+            int at = position[slot];
+            if (at < 0) {
+                return;
+            }
+
+            if (needs_inspection(*handle)) {
+                special--;
+            }
+            if (handle->callback == &signal::forward_flattened) {
+                bump_revision();
+            }
+
+            if (firing > 0) {
+                callbacks[at] = &signal::skip;
+                stale++;
+                return;
+            }
+
+            for (int next = at + 1; next < ordered; ++next) {
+                place(next - 1, order[next]);
+            }
+            ordered--;
+            position[slot] = -1;
+            vacant[available++] = slot;
+        }
+
+        /**
+         * @brief Purges stale entries and sorts queued connections into the dispatch order.
+         * @since 1.2.0
+         *
+         * Does nothing while the signal is firing. Otherwise it compacts the dispatch order
+         * and arrays in a single pass, returns the slots of disconnected connections to the
+         * vacant list and inserts the connections queued during the last `fire()`. Expired
+         * entries at the head of the one-shot ring are released as well.
+         */
+        void settle() {
+            if (firing > 0) {
+                return;
+            }
+
+            while (shot_count > 0 && !one_shots[shot_head].connected) {
+                shot_head = (shot_head + 1) % CPP_CONNECTIONS_MAX_ONE_SHOTS;
+                shot_count--;
+            }
+            if (stale == 0 && queued == 0) {
+                return;
+            }
+
+            int end = ordered + queued;
+            int kept = 0;
+            for (int at = 0; at < ordered; ++at) {
+                int slot = order[at];
+                if (connections[slot].connected) {
+                    place(kept++, slot);
+                } else {
+                    position[slot] = -1;
+                    vacant[available++] = slot;
+                }
+            }
+
+            int first_queued = ordered;
+            ordered = kept;
+            queued = 0;
+            stale = 0;
+
+            for (int at = first_queued; at < end; ++at) {
+                int slot = order[at];
+                if (connections[slot].connected) {
+                    insert(slot);
+                } else {
+                    vacant[available++] = slot;
+                }
+            }
+        }
+
+        /**
+         * @brief Copies the connections and dispatch order of another signal into this one.
+         * @since 1.2.0
+         *
+         * Used by the copy and move operations. The copied connections are re-owned
+         * by this signal, so disconnecting them reaches this signal's dispatch order.
+         * Their link records are set up by `adopt_links()`.
+         *
+         * @param other The signal to copy from.
+         * @param moving Whether `other` gives up its connections, see `abandon_connections()`.
+         */
+        void copy_connections(const signal& other, bool moving) {
+            for (int i = 0; i < other.touched; ++i) {
+                connections[i] = other.connections[i];
+                connections[i].owner = this;
+                position[i] = other.position[i];
+            }
+            for (int i = 0; i < other.ordered + other.queued; ++i) {
+                order[i] = other.order[i];
+            }
+            for (int i = 0; i < other.ordered; ++i) {
+                callbacks[i] = other.callbacks[i];
+                contexts[i] = other.contexts[i];
+                tags[i] = other.tags[i];
+            }
+            for (int i = 0; i < other.available; ++i) {
+                vacant[i] = other.vacant[i];
+            }
+            for (int i = 0; i < (other.touched + 31) / 32; ++i) {
+                blocked_slots[i] = other.blocked_slots[i];
+            }
+            for (int i = 0; i < other.shot_count; ++i) {
+                int at = (other.shot_head + i) % CPP_CONNECTIONS_MAX_ONE_SHOTS;
+                one_shots[at] = other.one_shots[at];
+                one_shots[at].owner = this;
+            }
+            for (int i = 0; i < shot_words; ++i) {
+                blocked_shots[i] = other.blocked_shots[i];
+            }
+
+            for (int i = 0; i < other.touched; ++i) {
+                if (connections[i].connected && connections[i].callback == &signal::timed_once) {
+                    drop_timeout(connections[i]);
+                    if (position[i] >= 0) {
+                        if (callbacks[position[i]] == &signal::timed_once) {
+                            callbacks[position[i]] = connections[i].callback;
+                        }
+                        contexts[position[i]] = connections[i].context;
+                    }
+                }
+            }
+            for (int i = 0; i < other.shot_count; ++i) {
+                connection<arguments...>& copied = one_shots[(other.shot_head + i) % CPP_CONNECTIONS_MAX_ONE_SHOTS];
+                if (copied.connected && copied.callback == &signal::timed_once) {
+                    drop_timeout(copied);
+                }
+            }
+
+            ordered = other.ordered;
+            queued = other.queued;
+            available = other.available;
+            touched = other.touched;
+            shot_head = other.shot_head;
+            shot_count = other.shot_count;
+            sequenced = other.sequenced;
+            live = other.live;
+            stale = other.stale;
+
+            for (int i = 0; i < touched; ++i) {
+                if (connections[i].connected) {
+                    adopt_links(connections[i], moving);
+                }
+            }
+            for (int i = 0; i < shot_count; ++i) {
+                connection<arguments...>& copied = one_shots[(shot_head + i) % CPP_CONNECTIONS_MAX_ONE_SHOTS];
+                if (copied.connected) {
+                    adopt_links(copied, moving);
+                }
+            }
+
+            special = 0;
+            for (int i = 0; i < ordered; ++i) {
+                if (connections[order[i]].connected && needs_inspection(connections[order[i]])) {
+                    special++;
+                }
+            }
+            settle();
+        }
+
+        /**
+         * @brief Sets up the link record of a connection copied from another signal.
+         * @since 1.2.0
+         *
+         * On entry `copied.links` still points at the original's record. A moved connection
+         * takes the record over, so its `trackable` and `connection_group` reach the new
+         * connection from now on. A copied connection gets a record of its own, linked in right
+         * behind the original's, so it is tracked by the same `trackable`, belongs to the same
+         * `connection_group` and keeps the original's tags.
+         *
+         * @param copied The new connection.
+         * @param moving Whether the original gives up its record.
+         */
+        static void adopt_links(connection<arguments...>& copied, bool moving) {
+            detail::connection_links* original = copied.links;
+            if (!original) {
+                return;
+            }
+
+            if (moving) {
+                original->tracking.subject = &copied;
+                original->grouping.subject = &copied;
+                return;
+            }
+
+            copied.links = nullptr;
+            copied.acquire_links();
+
+            copied.links->gate = original->gate;
+            copied.links->tags = original->tags;
+            if (original->tracking.previous) {
+                detail::link_after(original->tracking, copied.links->tracking, &copied);
+            }
+            if (original->grouping.previous) {
+                detail::link_after(original->grouping, copied.links->grouping, &copied);
+            }
+        }
+
+        /**
+         * @brief Disconnects every connection after they were moved to another signal.
+         * @since 1.2.0
+         *
+         * The link records went with the moved connections, so they are dropped here first.
+         * That leaves nothing for `release()` to count as special, so the count is reset too.
+         */
+        void abandon_connections() {
+            for (int i = 0; i < touched; ++i) {
+                connections[i].links = nullptr;
+            }
+            for (int i = 0; i < shot_count; ++i) {
+                one_shots[(shot_head + i) % CPP_CONNECTIONS_MAX_ONE_SHOTS].links = nullptr;
+            }
+
+            disconnect_all();
+            special = 0;
+        }
+
+        /**
+         * @brief Turns a copied connection made by `once_with_timeout()` into a plain one-shot connection.
+         * @since 1.2.0
+         *
+         * The timer keeps belonging to the original connection.
+         */
+        static void drop_timeout(connection<arguments...>& copied) {
+            timeout_record* record = static_cast<timeout_record*>(copied.context);
+            copied.callback = record->callback;
+            copied.context = record->context;
+        }
+
+        /**
+         * @brief No-op callback standing in for connections without a callback or disconnected mid-fire.
+         * @since 1.2.0
+         */
+        static void skip(void*, arguments...) {}
+
+        /**
+         * @brief Returns whether a connection needs per-connection handling in `fire()`.
+         * @since 1.2.0
+         *
+         * One-shot connections must be disconnected after they ran, flattened forwarding
+         * connections start a walk over their target and grouped connections check their gate.
+         */
+        static bool needs_inspection(const connection<arguments...>& handle) {
+            return handle.once || handle.callback == &signal::forward_flattened || (handle.links && handle.links->gate);
+        }
+
+        /**
+         * @brief Changes the gate of a connection, keeping the fast path bookkeeping in sync.
+         * @since 1.2.0
+         *
+         * Called by `connection_group` when a connection joins or leaves it.
+         *
+         * @param handle A connection of this signal.
+         * @param gate The new gate, or nullptr.
+         */
+        void regate(connection<arguments...>* handle, const bool* gate) {
+            bool before = needs_inspection(*handle);
+            handle->links->gate = gate;
+            if (one_shot_index(handle) >= 0) {
+                return;
+            }
+            bump_revision();
+
+            if (position[handle - connections] >= 0 && handle->connected && before != needs_inspection(*handle)) {
+                special += before ? -1 : 1;
+            }
+        }
+
+        /**
+         * @brief Blocks or unblocks a connection of this signal.
+         * @since 1.2.0
+         *
+         * Besides flipping the connection's bit in `blocked_slots`, the packed callback of a
+         * blocked connection is swapped for `skip()`, so the `fire()` fast path mutes it without
+         * any per-connection check. Plans are recompiled, since blocked forwarding edges are not inlined.
+         *
+         * @param handle A connected connection of this signal.
+         * @param blocked Whether the connection should be blocked.
+         */
+        void set_blocked(connection<arguments...>* handle, bool blocked) {
+            if (blocked == is_blocked(handle)) {
+                return;
+            }
+
+            int shot = one_shot_index(handle);
+            if (shot >= 0) {
+                blocked_shots[shot / 32] ^= 1u << (shot % 32);
+                return;
+            }
+
+            int slot = static_cast<int>(handle - connections);
+
+            blocked_slots[slot / 32] ^= 1u << (slot % 32);
+            if (position[slot] >= 0) {
+                callbacks[position[slot]] = !blocked && handle->callback ? handle->callback : &signal::skip;
+            }
+            bump_revision();
+        }
+
+        /**
+         * @brief Copies a connection's tags into the packed `tags` array.
+         * @since 1.2.0
+         */
+        void retag(const connection<arguments...>* handle) {
+            if (one_shot_index(handle) >= 0) {
+                return;
+            }
+
+            int at = position[handle - connections];
+            if (at >= 0) {
+                tags[at] = handle->tags();
+            }
+        }
+
+        /**
+         * @brief Returns whether a connection of this signal is blocked.
+         * @since 1.2.0
+         */
+        bool is_blocked(const connection<arguments...>* handle) const {
+            int shot = one_shot_index(handle);
+            if (shot >= 0) {
+                return (blocked_shots[shot / 32] >> (shot % 32)) & 1u;
+            }
+
+            int slot = static_cast<int>(handle - connections);
+            return (blocked_slots[slot / 32] >> (slot % 32)) & 1u;
+        }
+
+        /**
+         * @brief Callback installed by `forward_to()` in `forward_mode::nested`.
+         * @since 1.2.0
+         */
+        static void forward_nested(void* context, arguments... args) {
+            static_cast<signal*>(context)->fire(args...);
+        }
+
+        /**
+         * @brief Callback installed by `forward_to()` in `forward_mode::flattened`.
+         * @since 1.2.0
+         *
+         * `fire()` recognizes this callback and walks the target itself. It is only
+         * invoked directly when the connection was copied somewhere else, in which
+         * case it starts a flattened walk at the target.
+         */
+        static void forward_flattened(void* context, arguments... args) {
+            signal* target = static_cast<signal*>(context);
+
+            if (target->active) {
+                target->fire_flattened(0, 0, target->shot_count, args...);
+            } else {
+                target->fire(args...);
+            }
+        }
+
+        /**
+         * @brief Returns whether an event fired on this signal can reach `needle` through forwarding.
+         * @since 1.2.0
+         *
+         * Walks both nested and flattened forwarding connections. If the graph reaches more
+         * than `CPP_CONNECTIONS_MAX_FORWARD_SIGNALS` signals without finding `needle`, the
+         * answer is unknown and `undecided` is returned.
+         *
+         * @param needle The signal to look for, which counts as reached when it is this signal.
+         * @param undecided The result to report when the graph is too large to tell.
+         * @return `true` if `needle` is reachable, `false` if it is not.
+         */
+        bool forwards_into(const signal* needle, bool undecided) const {
+            const signal* pending[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+            const signal* visited[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+            int pending_count = 1;
+            int visited_count = 1;
+            pending[0] = this;
+            visited[0] = this;
+
+            while (pending_count > 0) {
+                const signal* current = pending[--pending_count];
+                if (current == needle) {
+                    return true;
+                }
+
+                for (int i = 0; i < current->touched; ++i) {
+                    const connection<arguments...>& slot = current->connections[i];
+                    if (!slot.connected || (slot.callback != &signal::forward_nested && slot.callback != &signal::forward_flattened)) {
+                        continue;
+                    }
+
+                    const signal* target = static_cast<const signal*>(slot.context);
+                    bool seen = false;
+                    for (int v = 0; v < visited_count; ++v) {
+                        if (visited[v] == target) {
+                            seen = true;
+                            break;
+                        }
+                    }
+                    if (seen) {
+                        continue;
+                    }
+
+                    if (visited_count == CPP_CONNECTIONS_MAX_FORWARD_SIGNALS) {
+                        return undecided;
+                    }
+                    visited[visited_count++] = target;
+                    pending[pending_count++] = target;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Continues `fire()` from `slot` as an iterative walk over flattened forwarding targets.
+         * @since 1.2.0
+         *
+         * Each flattened forwarding connection pushes its target onto an explicit stack
+         * instead of recursing, so subscribers run in the same depth-first order nested
+         * forwarding would produce. Every forwarded signal is entered at most once, and a
+         * subscriber of a forwarded signal is skipped if its (callback, context) pair already
+         * ran during this fire; this signal's own subscribers always run. Suspended
+         * targets are skipped (or buffer the event, see `suspend(event_log*)`).
+         *
+         * Forwarding cycles are refused by `forward_to()`, so if the walk runs out of stack
+         * it can safely fall back to firing the remaining targets recursively.
+         *
+         * The one-shot ring of every walked signal is merged into its dispatch order as in `fire()`.
+         * The caller must count as firing if it already ran part of this signal's ring.
+         *
+         * @param start Dispatch position of the first connection of this signal that has not run yet.
+         * @param next Index of the first entry of this signal's one-shot ring that has not run yet.
+         * @param shots Number of entries of this signal's one-shot ring to consider.
+         * @param args The argument pack forwarded to each callback function.
+         */
+        void fire_flattened(int start, int next, int shots, arguments... args) {
+            detail::walk_set<void (*)(void*, arguments...)> scratch;
+            detail::subscriber_set<void (*)(void*, arguments...)>& invoked = scratch.get();
+
+            for (int at = 0; at < start; ++at) {
+                connection<arguments...>& current = connections[order[at]];
+                if (current.connected && current.callback) {
+                    bool fresh;
+                    invoked.insert(current.callback, current.context, fresh);
+                }
+            }
+
+            auto enter = [&](connection<arguments...>& edge, signal* target) -> bool {
+                if (edge.muted()) {
+                    return false;
+                }
+                if (edge.once) {
+                    edge.disconnect();
+                }
+
+                if (!target->active) {
+                    target->fire(args...);
+                    return false;
+                }
+                return true;
+            };
+            auto invoke = [&](connection<arguments...>& subscriber, typename detail::subscriber_set<void (*)(void*, arguments...)>::entry*, bool run) {
+                if (!run || subscriber.muted()) {
+                    return;
+                }
+
+                subscriber.callback(subscriber.context, args...);
+
+                if (subscriber.once) {
+                    subscriber.disconnect();
+                }
+            };
+            auto drain = [&](signal* owner, connection<arguments...>& before, int& index, int limit) {
+                owner->run_one_shots(&before, index, limit, args...);
+            };
+            auto overflow = [&](connection<arguments...>&, signal* target) {
+                target->fire(args...);
+            };
+            auto finish = [&](connection<arguments...>*, signal* target, int& index, int limit) {
+                target->run_one_shots(nullptr, index, limit, args...);
+            };
+
+            walk_flattened(start, next, shots, invoked, enter, drain, invoke, overflow, finish);
+        }
+
+        /**
+         * @brief Depth-first walk over this signal and its flattened forwarding targets, starting at `slot`.
+         * @since 1.2.0
+         *
+         * Shared by `fire_flattened()` and `compile_plan()`. Each flattened forwarding connection
+         * is offered to `enter`, which returns whether its target should be walked. Targets already
+         * walked are skipped, and targets beyond the stack capacity are handed to `overflow`. Every
+         * other connection goes to `invoke`, together with its entry in `invoked` and whether it
+         * should run: a connection of a forwarded signal whose (callback, context) pair is already
+         * in `invoked` should not, while this signal's own connections always should.
+         *
+         * Every signal on the stack counts as firing, so connections made to it by the callbacks
+         * are queued and its dispatch order does not move underneath the walk. Each frame keeps
+         * its progress through the signal's one-shot ring, limited to the entries the ring had
+         * when the walk entered it: `drain` is called ahead of every listed connection so the
+         * ring can be merged in, and when a signal's connections are exhausted it is handed to
+         * `finish` for the rest of its ring.
+         *
+         * @param start Dispatch position of the first connection of this signal to visit.
+         * @param next Index of the first entry of this signal's one-shot ring not handled yet.
+         * @param shots Number of entries of this signal's one-shot ring to consider.
+         * @param invoked Subscribers that were already visited.
+         * @param enter Called as `bool(connection&, signal*)` for every flattened forwarding connection.
+         * @param drain Called as `void(signal*, connection&, int& next, int shots)` ahead of every
+         *              listed connection of a walked signal.
+         * @param invoke Called as `void(connection&, subscriber_set::entry*, bool)` for every subscriber;
+         *               the entry is nullptr if `invoked` is full.
+         * @param overflow Called as `void(connection&, signal*)` for targets that do not fit on the stack.
+         * @param finish Called as `void(connection*, signal*, int& next, int shots)` for every walked
+         *               signal, with the forwarding connection it was entered through (nullptr for this signal).
+         */
+        template<typename enter_function, typename drain_function, typename invoke_function, typename overflow_function,
+                 typename finish_function>
+        void walk_flattened(int start, int next, int shots, detail::subscriber_set<void (*)(void*, arguments...)>& invoked,
+                            enter_function& enter, drain_function& drain, invoke_function& invoke,
+                            overflow_function& overflow, finish_function& finish) {
+            struct frame {
+                signal* owner;
+                connection<arguments...>* edge;
+                int position;
+                int next;
+                int shots;
+            };
+
+            frame stack[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+            signal* visited[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+            int depth = 1;
+            int visited_count = 1;
+            stack[0].owner = this;
+            stack[0].edge = nullptr;
+            stack[0].position = start;
+            stack[0].next = next;
+            stack[0].shots = shots;
+            visited[0] = this;
+            firing++;
+
+            while (depth > 0) {
+                frame& top = stack[depth - 1];
+                if (top.position == top.owner->ordered) {
+                    finish(top.edge, top.owner, top.next, top.shots);
+                    top.owner->firing--;
+                    top.owner->settle();
+                    depth--;
+                    continue;
+                }
+
+                connection<arguments...>& current = top.owner->connections[top.owner->order[top.position++]];
+                if (top.next < top.shots) {
+                    drain(top.owner, current, top.next, top.shots);
+                }
+                if (!current.connected || !current.callback) {
+                    continue;
+                }
+
+                if (current.callback == &signal::forward_flattened) {
+                    signal* target = static_cast<signal*>(current.context);
+                    if (!enter(current, target)) {
+                        continue;
+                    }
+
+                    bool seen = false;
+                    for (int v = 0; v < visited_count; ++v) {
+                        if (visited[v] == target) {
+                            seen = true;
+                            break;
+                        }
+                    }
+                    if (seen) {
+                        continue;
+                    }
+
+                    if (visited_count == CPP_CONNECTIONS_MAX_FORWARD_SIGNALS) {
+                        overflow(current, target);
+                        continue;
+                    }
+
+                    visited[visited_count++] = target;
+                    stack[depth].owner = target;
+                    stack[depth].edge = &current;
+                    stack[depth].position = 0;
+                    stack[depth].next = 0;
+                    stack[depth].shots = target->shot_count;
+                    target->firing++;
+                    depth++;
+                    continue;
+                }
+
+                bool fresh;
+                typename detail::subscriber_set<void (*)(void*, arguments...)>::entry* seen =
+                    invoked.insert(current.callback, current.context, fresh);
+                invoke(current, seen, fresh || depth == 1);
+            }
+        }
+
+        /**
+         * @brief Rebuilds the attached dispatch plan from the current connection topology.
+         * @since 1.2.0
+         *
+         * Records exactly the sequence of callbacks `fire()` would run right now: this signal's
+         * own connections, then the flattened walk from its first flattened forwarding connection.
+         * Forwarding connections that cannot be inlined (one-shot, grouped and blocked ones and
+         * those leading to suspended signals) are recorded as ordinary callbacks. If the plan runs out of room
+         * it is marked unusable and `fire()` falls back to the regular dispatch path.
+         *
+         * Subscribers of forwarded signals that the walk skips as duplicates are recorded too,
+         * linked to the earlier entries with the same (callback, context) pair, so they take over
+         * once those are disconnected without the plan being recompiled. The plan also records
+         * the revision of this signal and of every forwarded signal it looked into.
+         *
+         * The one-shot rings change without invalidating the plan, so they are not recorded.
+         * Instead a marker step is added ahead of each inlined forwarding connection and at the
+         * end of each walked signal, telling `fire_plan()` where to merge each ring in.
+         */
+        void compile_plan() {
+            typedef detail::subscriber_set<void (*)(void*, arguments...)> pair_set;
+
+            dispatch_plan<arguments...>* target_plan = plan;
+            target_plan->count = 0;
+            target_plan->markers = 0;
+            target_plan->source_count = 0;
+            target_plan->usable = true;
+
+            auto record = [target_plan](signal* source) -> int {
+                for (unsigned int i = 0; i < target_plan->source_count; ++i) {
+                    if (target_plan->sources[i] == source) {
+                        return static_cast<int>(i);
+                    }
+                }
+                if (target_plan->source_count == CPP_CONNECTIONS_MAX_FORWARD_SIGNALS) {
+                    target_plan->usable = false;
+                    return -1;
+                }
+
+                target_plan->sources[target_plan->source_count] = source;
+                target_plan->revisions[target_plan->source_count] = source->revision;
+                return static_cast<int>(target_plan->source_count++);
+            };
+            auto append = [target_plan, &record](void (*callback)(void*, arguments...), void* context, connection<arguments...>* handle,
+                                                 signal* source, typename pair_set::entry* seen, bool always) {
+                int frame = record(source);
+                if (frame < 0 || target_plan->count == CPP_CONNECTIONS_MAX_PLAN_ENTRIES) {
+                    target_plan->usable = false;
+                    return;
+                }
+
+                int index = static_cast<int>(target_plan->count++);
+                typename dispatch_plan<arguments...>::entry& added = target_plan->entries[index];
+                added.callback = callback;
+                added.context = context;
+                added.handle = handle;
+                added.sequence = handle ? handle->sequence : 0;
+                added.frame = frame;
+                added.previous = seen ? seen->last : -1;
+                added.always = always;
+                if (seen) {
+                    seen->last = index;
+                }
+                if (!callback) {
+                    target_plan->markers++;
+                }
+            };
+
+            record(this);
+
+            detail::walk_set<void (*)(void*, arguments...)> scratch;
+            pair_set& invoked = scratch.get();
+            int at = 0;
+            for (; at < ordered; ++at) {
+                connection<arguments...>& current = connections[order[at]];
+                if (!current.connected || !current.callback) {
+                    continue;
+                }
+                if (current.callback == &signal::forward_flattened) {
+                    break;
+                }
+
+                bool fresh;
+                append(current.callback, current.context, &current, this,
+                       invoked.insert(current.callback, current.context, fresh), true);
+            }
+
+            if (at < ordered) {
+                auto enter = [&](connection<arguments...>& edge, signal* target) -> bool {
+                    if (edge.once || (edge.links && edge.links->gate) || edge.blocked()) {
+                        append(&signal::forward_flattened, target, &edge, edge.owner, nullptr, true);
+                        return false;
+                    }
+                    record(target);
+                    if (!target->active) {
+                        append(&signal::forward_nested, target, &edge, edge.owner, nullptr, true);
+                        return false;
+                    }
+
+                    append(nullptr, nullptr, &edge, edge.owner, nullptr, true);
+                    return true;
+                };
+                auto drain = [](signal*, connection<arguments...>&, int&, int) {};
+                auto invoke = [&](connection<arguments...>& subscriber, typename pair_set::entry* seen, bool run) {
+                    append(subscriber.callback, subscriber.context, &subscriber, subscriber.owner, seen, run);
+                };
+                auto overflow = [&](connection<arguments...>& edge, signal* target) {
+                    append(&signal::forward_nested, target, &edge, edge.owner, nullptr, true);
+                };
+                auto finish = [&](connection<arguments...>*, signal* target, int&, int) {
+                    append(nullptr, nullptr, nullptr, target, nullptr, true);
+                };
+
+                walk_flattened(at, 0, 0, invoked, enter, drain, invoke, overflow, finish);
+            } else {
+                append(nullptr, nullptr, nullptr, this, nullptr, true);
+            }
+
+            target_plan->compiled = true;
+        }
+
+        /**
+         * @brief Runs the compiled dispatch plan as one linear loop.
+         * @since 1.2.0
+         *
+         * Entries whose connection was disconnected in the meantime (for example by an
+         * earlier callback of the same pass), including those whose slot was taken by a newer
+         * connection since, or whose group is suspended are skipped, and
+         * one-shot connections are disconnected after their callback ran. Duplicates found
+         * by the flattened walk are skipped while an earlier entry of their pair is connected.
+         *
+         * The one-shot rings of the signals the plan was compiled from change without
+         * invalidating it. Every step therefore first runs the ring entries of its signal
+         * that come before it, limited to the entries the ring had when the fire began.
+         *
+         * @param args The argument pack forwarded to each callback function.
+         */
+        void fire_plan(arguments... args) {
+            dispatch_plan<arguments...>* current_plan = plan;
+            current_plan->running++;
+
+            int next[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+            int shots[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+            unsigned int sources = current_plan->source_count;
+            for (unsigned int i = 0; i < sources; ++i) {
+                next[i] = 0;
+                shots[i] = current_plan->sources[i]->shot_count;
+                current_plan->sources[i]->firing++;
+            }
+
+            for (unsigned int i = 0; i < current_plan->count; ++i) {
+                typename dispatch_plan<arguments...>::entry& step = current_plan->entries[i];
+                if (!current_plan->present(step)) {
+                    // The slot's priority is no longer the entry's; the next step merges the ring in.
+                    continue;
+                }
+                if (next[step.frame] < shots[step.frame]) {
+                    current_plan->sources[step.frame]->run_one_shots(step.handle, next[step.frame], shots[step.frame], args...);
+                }
+                if (!step.callback || !step.handle->connected || step.handle->muted() || current_plan->shadowed(step)) {
+                    continue;
+                }
+
+                step.callback(step.context, args...);
+
+                if (step.handle->once) {
+                    step.handle->disconnect();
+                }
+            }
+
+            for (unsigned int i = 0; i < sources; ++i) {
+                current_plan->sources[i]->firing--;
+                current_plan->sources[i]->settle();
+            }
+            current_plan->running--;
+        }
+
+        /**
+         * @brief Flag indicating whether the signal is currently active and firing callbacks.
+         * @since 1.1.0
+         *
+         * When this flag is set to false, calls to `fire()` will immediately return
+         * without invoking any callbacks, effectively suspending event dispatch.
+         * Connections remain registered and can be resumed later.
+         */
+        bool active;
+
+        /**
+         * @brief Log receiving events fired while suspended, or nullptr to discard them.
+         * @since 1.2.0
+         *
+         * Set by `suspend(event_log*)` and consumed by `resume()`, which replays
+         * the buffered events and detaches the log again.
+         */
+        event_log<arguments...>* backlog;
+
+        /**
+         * @brief Fires scheduled with `fire_after()` and `fire_every()` that are still pending.
+         * @since 1.2.0
+         */
+        detail::link_list scheduled;
+
+        /**
+         * @brief Compiled dispatch plan used by `fire()` while frozen, or nullptr.
+         * @since 1.2.0
+         */
+        dispatch_plan<arguments...>* plan;
+
+        /**
+         * @brief Fixed-size array storing all possible connection slots managed by this signal.
+         * @since 1.0.0
+         *
+         * Each element represents a possible registered callback connection,
+         * including its active status, callback pointer, and context.
+         * The size is defined by `CPP_CONNECTIONS_MAX_CONNECTIONS`.
+         */
+        connection<arguments...> connections[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Slot indices in dispatch order, sorted by descending priority and then insertion.
+         * @since 1.2.0
+         *
+         * The first `ordered` entries form the sorted dispatch order and may still contain
+         * disconnected (stale) connections. The `queued` entries behind them were connected
+         * while the signal was firing and have not been sorted in yet.
+         */
+        int order[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Callback of each entry in the sorted part of `order`, or `skip()` for stale entries.
+         * @since 1.2.0
+         *
+         * Together with `contexts` this is the packed storage the `fire()` fast path walks.
+         * `connections` keeps the handles, so handles stay valid while entries move.
+         */
+        void (*callbacks[CPP_CONNECTIONS_MAX_CONNECTIONS])(void* context, arguments...);
+
+        /**
+         * @brief Context of each entry in the sorted part of `order`.
+         * @since 1.2.0
+         */
+        void* contexts[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Tags of each entry in the sorted part of `order`, scanned by `fire_masked()`.
+         * @since 1.2.0
+         */
+        tag_mask tags[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Position of each slot in the sorted part of `order`, or -1 if it is not listed there.
+         * @since 1.2.0
+         */
+        int position[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Bitmap of blocked connections, indexed by slot.
+         * @since 1.2.0
+         *
+         * Words beyond the one holding slot `touched - 1` are uninitialized; `attach()`
+         * zeroes each word when its first slot is handed out.
+         */
+        unsigned int blocked_slots[blocked_words];
+
+        /**
+         * @brief Ring of one-shot connections made by `once()` with the default priority.
+         * @since 1.2.0
+         *
+         * The `shot_count` entries starting at `shot_head` are in use, in insertion order.
+         * Connections stay in place until they expire, so their handles remain valid;
+         * `settle()` releases the expired entries at the head of the ring.
+         */
+        connection<arguments...> one_shots[CPP_CONNECTIONS_MAX_ONE_SHOTS];
+
+        /**
+         * @brief Bitmap of blocked connections in `one_shots`, indexed by ring entry.
+         * @since 1.2.0
+         */
+        unsigned int blocked_shots[shot_words];
+
+        /**
+         * @brief Number of entries in the sorted part of `order`.
+         * @since 1.2.0
+         */
+        int ordered;
+
+        /**
+         * @brief Number of entries queued behind the sorted part of `order`.
+         * @since 1.2.0
+         */
+        int queued;
+
+        /**
+         * @brief Stack of recycled slot indices that are neither connected nor listed in `order`.
+         * @since 1.2.0
+         */
+        int vacant[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Number of entries in `vacant`.
+         * @since 1.2.0
+         */
+        int available;
+
+        /**
+         * @brief Number of slots handed out at least once; slots at and beyond it were never used.
+         * @since 1.2.0
+         */
+        int touched;
+
+        /**
+         * @brief Index of the oldest entry in use in `one_shots`.
+         * @since 1.2.0
+         */
+        int shot_head;
+
+        /**
+         * @brief Number of entries in use in `one_shots`, including expired ones not yet released.
+         * @since 1.2.0
+         */
+        int shot_count;
+
+        /**
+         * @brief Number of connected connections, returned by `connection_count()`.
+         * @since 1.2.0
+         */
+        int live;
+
+        /**
+         * @brief Number of disconnections since the dispatch order was last purged.
+         * @since 1.2.0
+         */
+        int stale;
+
+        /**
+         * @brief Number of live entries in the dispatch order that `needs_inspection()`.
+         * @since 1.2.0
+         *
+         * While it is zero, `fire()` uses the packed fast path.
+         */
+        int special;
+
+        /**
+         * @brief Nesting depth of dispatch loops currently iterating the dispatch order.
+         * @since 1.2.0
+         */
+        int firing;
+
+        /**
+         * @brief Revision of the parts of this signal a `dispatch_plan` depends on.
+         * @since 1.2.0
+         *
+         * Renewed from `detail::topology` by `bump_revision()` whenever a connection is made,
+         * a flattened forwarding connection is removed, a connection is blocked, unblocked,
+         * grouped or ungrouped, or the signal is suspended, resumed, copied or moved.
+         * Removing any other connection leaves it alone, since plans skip disconnected entries.
+         */
+        unsigned long revision;
+
+        /**
+         * @brief Number of connections made so far, which gives each new connection its `sequence`.
+         * @since 1.2.0
+         */
+        unsigned long long sequenced;
+    };
+
+    /**
+     * @brief RAII-style scoped wrapper for managing a single connection's lifetime.
+     * @since 1.1.0
+     *
+     * This utility struct provides automatic management of a pointer to a
+     * `connection` object, ensuring that the connection is properly disconnected
+     * when the scoped_connection instance is destroyed. This pattern helps prevent
+     * dangling connections and resource leaks by tying the connection's lifetime
+     * to the scoped_connection's lifetime, following RAII (Resource Acquisition Is Initialization).
+     *
+     * The class disables copy operations to avoid multiple owners of the same
+     * connection, which could lead to double-disconnect errors or undefined behavior.
+     * Move semantics are supported to allow transferring ownership safely.
+     *
+     * Typical usage includes creating a scoped_connection from a raw connection pointer
+     * returned by a signal's `connect()` method, allowing the connection to be
+     * automatically disconnected when the scoped_connection goes out of scope.
+     *
+     * @tparam arguments The variadic template parameter pack representing the
+     *                   argument types that the underlying connection's callback accepts.
+     */
+    template<typename... arguments>
+    struct scoped_connection {
+        /**
+         * @brief Pointer to the managed connection object.
+         * @since 1.1.0
+         *
+         * This raw pointer holds the address of the connection being managed by this
+         * scoped_connection instance. It may be nullptr, indicating no connection
+         * is currently managed. When valid and the connection is active (`connected == true`),
+         * this pointer is used to invoke `disconnect()` automatically upon destruction.
+         *
+         * Ownership semantics:
+         * - The scoped_connection assumes responsibility for disconnecting the connection,
+         *   but does not delete or free the pointer itself.
+         * - After destruction or move, this pointer is reset to nullptr to avoid dangling references.
+         */
+        connection<arguments...>* conn = nullptr;
+
+        /**
+         * @brief Default constructor creates an empty scoped_connection managing no connection.
+         * @since 1.1.0
+         *
+         * The constructed object will hold a null connection pointer,
+         * meaning no connection is managed and no disconnection will occur
+         * upon destruction unless a connection is assigned later.
+         */
+        scoped_connection() = default;
+
+        /**
+         * @brief Constructs a scoped_connection that takes ownership of the given connection pointer.
+         * @since 1.1.0
+         *
+         * The provided connection pointer is assumed to point to a valid connection
+         * object whose lifetime is managed externally. This constructor does not
+         * allocate or create a connection; it only takes responsibility for calling
+         * `disconnect()` on destruction.
+         *
+         * @param c Pointer to the connection to manage. Must not be deleted
+         *          by this scoped_connection, but will be disconnected on destruction.
+         */
+        explicit scoped_connection(connection<arguments...>* c) : conn(c) {}
+
+        /**
+         * @brief Destructor automatically disconnects the managed connection if it is active.
+         * @since 1.1.0
+         *
+         * When the scoped_connection goes out of scope or is destroyed, this destructor
+         * checks whether it currently owns a non-null pointer to an active connection.
+         * If so, it calls the connection's `disconnect()` method to mark the connection
+         * as inactive and prevent further callback invocations.
+         *
+         * This automatic disconnection helps ensure that dangling callbacks or
+         * unexpected invocations do not occur after the scoped_connection is destroyed,
+         * thereby improving safety and resource management.
+         */
+        ~scoped_connection() {
+            if (conn && conn->connected) {
+                conn->disconnect();
+            }
+        }
+
+        /**
+         * @brief Copy constructor is explicitly deleted to prevent copying ownership.
+         * @since 1.1.0
+         *
+         * Copying scoped_connection objects is disallowed because multiple instances
+         * managing the same connection pointer could lead to double disconnection attempts
+         * and undefined behavior. This ensures unique ownership semantics.
+         */
+        scoped_connection(const scoped_connection&) = delete;
+
+        /**
+         * @brief Copy assignment operator is explicitly deleted to prevent copying ownership.
+         * @since 1.1.0
+         *
+         * Copy assignment is disabled for the same reasons as the copy constructor:
+         * to enforce exclusive ownership and avoid resource management errors.
+         */
+        scoped_connection& operator=(const scoped_connection&) = delete;
+
+        /**
+         * @brief Move constructor transfers ownership of the managed connection pointer.
+         * @since 1.1.0
+         *
+         * This constructor enables transferring the management responsibility from
+         * an existing scoped_connection to a new instance, leaving the moved-from
+         * instance in a valid but empty state with a null pointer.
+         *
+         * Ownership is transferred by moving the raw connection pointer,
+         * preventing disconnection from being called multiple times.
+         *
+         * @param other The scoped_connection instance to move from.
+         */
+        scoped_connection(scoped_connection&& other) noexcept : conn(other.conn) {
+            other.conn = nullptr;
+        }
+
+        /**
+         * @brief Move assignment operator disconnects current connection if active,
+         *        then takes ownership from the given scoped_connection.
+         * @since 1.1.0
+         *
+         * This operator enables assignment of a scoped_connection by transferring
+         * ownership of the managed connection pointer from the `other` instance.
+         * If this instance currently manages a connection, it will first disconnect it
+         * to prevent leaks or lingering callbacks before taking over the new connection.
+         *
+         * After assignment, the moved-from instance is left in a valid empty state.
+         *
+         * @param other The scoped_connection instance to move from.
+         * @return Reference to this scoped_connection after assignment.
+         */
+        scoped_connection& operator=(scoped_connection&& other) noexcept {
+            if (this != &other) {
+                if (conn && conn->connected) {
+                    conn->disconnect();
+                }
+                conn = other.conn;
+                other.conn = nullptr;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Releases ownership of the managed connection without disconnecting it.
+         * @since 1.1.0
+         *
+         * This function relinquishes management responsibility over the connection,
+         * returning the raw pointer to the caller and setting the internal pointer
+         * to nullptr to prevent disconnection on destruction.
+         *
+         * After calling `release()`, the scoped_connection no longer affects the connection's lifetime,
+         * and the caller assumes full responsibility for managing the connection manually.
+         *
+         * @return The raw pointer to the managed connection prior to release, or nullptr if none.
+         */
+        connection<arguments...>* release() {
+            auto temp = conn;
+            conn = nullptr;
+            return temp;
+        }
+    };
+
+    /**
+     * @brief Connects a pre-existing connection object’s callback to a given signal.
+     * @since 1.0.0
+     *
+     * This free function facilitates connecting a callback described by a
+     * `connection` struct to a specified signal instance, forwarding the
+     * callback function pointer and user context stored in the connection.
+     *
+     * This is useful when managing or copying connection descriptors externally
+     * before registering them to signals. Since 1.2.0 the priority is copied as well.
+     *
+     * @param connection The connection struct containing the callback, context and priority.
+     * @param signal Pointer to the signal instance where the callback should be connected.
+     * @return Pointer to the internal connection object inside the signal, or nullptr if the signal is full.
+     */
+    template<typename... arguments>
+    connection<arguments...>* connect(const connection<arguments...>& connection, signal<arguments...>* signal) {
+        return signal->connect(connection.callback, connection.context, connection.priority);
+    }
+
+    /**
+     * @brief Connects a one-shot connection object’s callback to a signal.
+     * @since 1.1.0
+     *
+     * Similar to `connect()`, but this function registers the callback as a one-shot listener,
+     * which will disconnect itself automatically after the first invocation.
+     *
+     * This facilitates easily setting up single-use event listeners externally.
+     *
+     * @param connection The connection struct containing the callback, context and priority.
+     * @param signal Pointer to the signal instance to register with.
+     * @return Pointer to the internal connection object inside the signal, or nullptr if full.
+     */
+    template<typename... arguments>
+    connection<arguments...>* connect_once(const connection<arguments...>& connection, signal<arguments...>* signal) {
+        return signal->once(connection.callback, connection.context, connection.priority);
+    }
+
+    /**
+     * @brief Establishes forwarding of events from one signal to another.
+     * @note This is a convenience function that calls the `forward_to` member on the source signal.
+     * @since 1.1.0
+     *
+     * When invoked, it sets up the source signal to automatically invoke
+     * the target signal whenever it is fired, forwarding all event arguments transparently.
+     *
+     * This is useful for composing signals or chaining event propagation.
+     *
+     * @param from Pointer to the source signal that will forward its events.
+     * @param to Pointer to the destination signal that will receive forwarded events.
+     * @param mode How events are propagated to the destination. Defaults to `forward_mode::nested`.
+     * @return Pointer to the connection object responsible for the forwarding, allowing management or disconnection,
+     *         or nullptr if the source is full or the forwarding would create a cycle.
+     */
+    template<typename... arguments>
+    connection<arguments...>* forward_to(signal<arguments...>* from, signal<arguments...>* to, forward_mode mode = forward_mode::nested) {
+        return from->forward_to(to, mode);
+    }
+
+    /**
+     * @brief Disconnects a specific connection by marking it inactive.
+     * @note This function takes the connection by reference to modify the original object.
+     * @since 1.0.0
+     *
+     * Calling this function ensures that the given connection will no longer
+     * be considered active by any signal, effectively preventing its callback
+     * from being invoked on future signal firings.
+     *
+     * @param connection The connection object to disconnect.
+     */
+    template<typename... arguments>
+    void disconnect(connection<arguments...>& connection) {
         connection.disconnect();
     }
+
+    /**
+     * @brief Selects how repeated events are folded together while they wait to be dispatched.
+     * @since 1.2.0
+     *
+     * - `keep_last` keeps a single pending event and overwrites its arguments on every record.
+     * - `keep_first` keeps a single pending event and ignores later records until it is dispatched.
+     * - `accumulate` keeps every recorded event, up to `CPP_CONNECTIONS_MAX_QUEUED_EVENTS`.
+     */
+    enum class coalesce_policy {
+        keep_last,
+        keep_first,
+        accumulate
+    };
+
+    /**
+     * @brief Fixed-capacity buffer of pending events that can later be replayed into a signal.
+     * @since 1.2.0
+     *
+     * An event log stores copies of a signal's argument list and folds them together
+     * according to its `coalesce_policy`. Replaying the log fires the target signal once
+     * per stored event, in the order they were recorded.
+     *
+     * Events are held in a ring buffer: replay pops each event into a local copy before
+     * firing it, so callbacks may safely record new events into the same log. Those new
+     * events are not dispatched by the replay in progress and remain pending for the next one.
+     *
+     * @note Argument types are stored by value with references and `const` removed,
+     *       so they must be default constructible and copy assignable.
+     *
+     * @tparam arguments The argument types of the signal the events belong to.
+     */
+    template<typename... arguments>
+    class event_log {
+    public:
+        /**
+         * @brief Constructs an empty event log using the given coalescing policy.
+         * @since 1.2.0
+         *
+         * @param coalescing How repeated records are folded together. Defaults to `keep_last`.
+         */
+        explicit event_log(coalesce_policy coalescing = coalesce_policy::keep_last)
+            : policy(coalescing), head(0), count(0) {}
+
+        /**
+         * @brief Records an event, coalescing it with pending events according to the policy.
+         * @since 1.2.0
+         *
+         * With `keep_last` the pending event's arguments are overwritten, with `keep_first`
+         * the new arguments are ignored, and with `accumulate` the event is appended.
+         *
+         * @param args The event arguments to store.
+         * @return `true` if the event was stored or coalesced, `false` if the log is full.
+         */
+        bool record(arguments... args) {
+            if (count > 0 && policy != coalesce_policy::accumulate) {
+                if (policy == coalesce_policy::keep_last) {
+                    events[newest()].store(args...);
+                }
+                return true;
+            }
+
+            if (count == CPP_CONNECTIONS_MAX_QUEUED_EVENTS) {
+                return false;
+            }
+
+            unsigned int tail = head + count;
+            if (tail >= CPP_CONNECTIONS_MAX_QUEUED_EVENTS) {
+                tail -= CPP_CONNECTIONS_MAX_QUEUED_EVENTS;
+            }
+            events[tail].store(args...);
+            count++;
+            return true;
+        }
+
+        /**
+         * @brief Fires the target signal once for every event pending when the replay starts.
+         * @since 1.2.0
+         *
+         * Events are removed from the log before they are dispatched. Events recorded
+         * by callbacks during the replay stay in the log for the next replay.
+         *
+         * @param target The signal to fire with the stored arguments.
+         * @return The number of events that were dispatched.
+         */
+        unsigned int replay(signal<arguments...>& target) {
+            unsigned int pending = count;
+            unsigned int dispatched = 0;
+
+            while (pending > 0 && count > 0) {
+                detail::argument_pack<arguments...> event = events[head];
+                if (++head == CPP_CONNECTIONS_MAX_QUEUED_EVENTS) {
+                    head = 0;
+                }
+                count--;
+                pending--;
+
+                event.fire_into(target);
+                dispatched++;
+            }
+            return dispatched;
+        }
+
+        /**
+         * @brief Discards every pending event without dispatching it.
+         * @since 1.2.0
+         */
+        void clear() {
+            head = 0;
+            count = 0;
+        }
+
+        /**
+         * @brief Changes the coalescing policy used for future records.
+         * @since 1.2.0
+         *
+         * Events that are already pending are kept as they are.
+         *
+         * @param new_policy The policy to apply from now on.
+         */
+        void set_policy(coalesce_policy new_policy) {
+            policy = new_policy;
+        }
+
+        /**
+         * @brief Returns the coalescing policy currently in use.
+         * @since 1.2.0
+         */
+        coalesce_policy get_policy() const {
+            return policy;
+        }
+
+        /**
+         * @brief Returns the number of events waiting to be replayed.
+         * @since 1.2.0
+         */
+        unsigned int size() const {
+            return count;
+        }
+
+        /**
+         * @brief Returns whether no events are waiting to be replayed.
+         * @since 1.2.0
+         */
+        bool empty() const {
+            return count == 0;
+        }
+
+    private:
+        unsigned int newest() const {
+            unsigned int index = head + count - 1;
+            return index >= CPP_CONNECTIONS_MAX_QUEUED_EVENTS ? index - CPP_CONNECTIONS_MAX_QUEUED_EVENTS : index;
+        }
+
+        /**
+         * @brief How repeated records are folded into pending events.
+         * @since 1.2.0
+         */
+        coalesce_policy policy;
+
+        /**
+         * @brief Index of the oldest pending event in the ring buffer.
+         * @since 1.2.0
+         */
+        unsigned int head;
+
+        /**
+         * @brief Number of pending events in the ring buffer.
+         * @since 1.2.0
+         */
+        unsigned int count;
+
+        /**
+         * @brief Ring buffer holding the stored argument lists.
+         * @since 1.2.0
+         */
+        detail::argument_pack<arguments...> events[CPP_CONNECTIONS_MAX_QUEUED_EVENTS];
+    };
+
+    /**
+     * @brief Flattened, precomputed sequence of callbacks a frozen signal runs when fired.
+     * @since 1.2.0
+     *
+     * A plan is attached to a signal with `signal::freeze()` and filled by the signal itself.
+     * It stores the (callback, context) pairs reached from the signal through flattened
+     * forwarding, in dispatch order and deduplicated, together with the connection each pair
+     * came from so disconnected and one-shot connections are still honored.
+     *
+     * The plan remembers the revisions of the signals it was compiled from and is rebuilt lazily
+     * by the next `fire()` once one of them changed. The signals are compared in the order the
+     * plan reached them, so a forwarding connection removed before its target was destroyed is
+     * noticed before the destroyed target would be looked at.
+     *
+     * @tparam arguments The argument types of the signal the plan belongs to.
+     */
+    template<typename... arguments>
+    class dispatch_plan {
+    public:
+        /**
+         * @brief Constructs an empty plan that has not been compiled yet.
+         * @since 1.2.0
+         */
+        dispatch_plan() : count(0), markers(0), source_count(0), running(0), compiled(false), usable(false) {}
+
+        dispatch_plan(const dispatch_plan&) = delete;
+        dispatch_plan& operator=(const dispatch_plan&) = delete;
+
+        /**
+         * @brief Returns the number of callbacks in the last compiled plan.
+         * @since 1.2.0
+         */
+        unsigned int size() const {
+            return count - markers;
+        }
+
+        /**
+         * @brief Returns whether the plan is compiled, fits its capacity and matches the current topology.
+         * @since 1.2.0
+         */
+        bool valid() const {
+            return compiled && usable && current();
+        }
+
+    private:
+        friend class signal<arguments...>;
+
+        /**
+         * @brief One compiled dispatch step.
+         * @since 1.2.0
+         *
+         * Steps without a callback are markers: they only tell `fire()` where to merge in the
+         * one-shot ring of `sources[frame]`, ahead of `handle` or, with a null `handle`, all of it.
+         */
+        struct entry {
+            void (*callback)(void* context, arguments...);
+            void* context;
+            connection<arguments...>* handle;
+
+            /**
+             * @brief The `connection::sequence` of `handle` when the plan was compiled.
+             * @since 1.2.0
+             *
+             * A slot freed by a disconnection can be taken by a connection made while the plan
+             * runs, so the slot pointer alone does not tell whether the entry's connection exists.
+             */
+            unsigned long long sequence;
+
+            /**
+             * @brief Index in `sources` of the signal `handle` belongs to.
+             * @since 1.2.0
+             */
+            int frame;
+
+            /**
+             * @brief Index of the previous entry with the same (callback, context) pair, or -1.
+             * @since 1.2.0
+             */
+            int previous;
+
+            /**
+             * @brief Whether the entry runs regardless of earlier entries with the same pair.
+             * @since 1.2.0
+             */
+            bool always;
+        };
+
+        /**
+         * @brief Returns whether every recorded signal still has the revision the plan was compiled from.
+         * @since 1.2.0
+         */
+        bool current() const {
+            for (unsigned int i = 0; i < source_count; ++i) {
+                if (sources[i]->revision != revisions[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Returns whether the slot of an entry still holds the connection it was compiled from.
+         * @since 1.2.0
+         */
+        static bool present(const entry& step) {
+            return !step.handle || step.handle->sequence == step.sequence;
+        }
+
+        /**
+         * @brief Returns whether a duplicate entry is hidden by an earlier, still connected entry of its pair.
+         * @since 1.2.0
+         */
+        bool shadowed(const entry& step) const {
+            if (step.always) {
+                return false;
+            }
+
+            for (int at = step.previous; at >= 0; at = entries[at].previous) {
+                if (present(entries[at]) && entries[at].handle->connected) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Compiled dispatch steps in the order `fire()` runs them.
+         * @since 1.2.0
+         */
+        entry entries[CPP_CONNECTIONS_MAX_PLAN_ENTRIES];
+
+        /**
+         * @brief Number of valid entries in `entries`.
+         * @since 1.2.0
+         */
+        unsigned int count;
+
+        /**
+         * @brief Number of markers among the valid entries.
+         * @since 1.2.0
+         */
+        unsigned int markers;
+
+        /**
+         * @brief The signals the plan was compiled from, in the order it reached them.
+         * @since 1.2.0
+         *
+         * Holds the frozen signal, every forwarded signal whose subscribers were inlined and
+         * every suspended one that was looked at. A plan that would depend on more than
+         * `CPP_CONNECTIONS_MAX_FORWARD_SIGNALS` signals is marked unusable.
+         */
+        signal<arguments...>* sources[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+
+        /**
+         * @brief Revision each signal in `sources` had when the plan was compiled.
+         * @since 1.2.0
+         */
+        unsigned long revisions[CPP_CONNECTIONS_MAX_FORWARD_SIGNALS];
+
+        /**
+         * @brief Number of entries in `sources`.
+         * @since 1.2.0
+         */
+        unsigned int source_count;
+
+        /**
+         * @brief Nesting depth of `fire()` calls currently running this plan.
+         * @since 1.2.0
+         *
+         * A stale plan is never recompiled while it is running; re-entrant fires
+         * use the regular dispatch path instead.
+         */
+        unsigned int running;
+
+        /**
+         * @brief Whether the plan was compiled at least once since it was attached.
+         * @since 1.2.0
+         */
+        bool compiled;
+
+        /**
+         * @brief Whether the last compilation fit into `CPP_CONNECTIONS_MAX_PLAN_ENTRIES`.
+         * @since 1.2.0
+         */
+        bool usable;
+    };
+
+    /**
+     * @brief Freezes a set of signals, compiling one dispatch plan per signal.
+     * @note This is a convenience function that calls the `freeze` member on every signal.
+     * @since 1.2.0
+     *
+     * Intended to be called once the signal graph has been wired at startup,
+     * so the compilation cost is paid up front instead of by the first `fire()`.
+     *
+     * @param signals Array of `count` signals to freeze.
+     * @param plans Array of `count` plans, where `plans[i]` is used by `signals[i]`.
+     * @param count Number of signals to freeze.
+     */
+    template<typename... arguments>
+    void freeze(signal<arguments...>* const* signals, dispatch_plan<arguments...>* plans, unsigned int count) {
+        for (unsigned int i = 0; i < count; ++i) {
+            signals[i]->freeze(&plans[i]);
+        }
+    }
+
+    namespace detail {
+        /**
+         * @brief Intrusive circular list node linking deferred signals into a `deferred_queue`.
+         * @since 1.2.0
+         *
+         * An unlinked node points at itself, so a node can always remove itself
+         * from whatever list currently holds it without knowing the list head.
+         */
+        struct deferred_link {
+            deferred_link* previous;
+            deferred_link* next;
+            void* owner;
+            void (*flush)(void* owner);
+
+            deferred_link() : previous(this), next(this), owner(nullptr), flush(nullptr) {}
+
+            deferred_link(const deferred_link&) = delete;
+            deferred_link& operator=(const deferred_link&) = delete;
+
+            bool linked() const {
+                return next != this;
+            }
+
+            void unlink() {
+                previous->next = next;
+                next->previous = previous;
+                previous = this;
+                next = this;
+            }
+
+            void push_back(deferred_link* node) {
+                node->previous = previous;
+                node->next = this;
+                previous->next = node;
+                previous = node;
+            }
+        };
+    }
+
+    /**
+     * @brief Collects deferred signals that have pending events and flushes them in one batch.
+     * @since 1.2.0
+     *
+     * A deferred signal attached to a queue links itself into the queue the first time
+     * an event is recorded after its last flush. Calling `flush()` once per frame then
+     * dispatches every pending signal exactly once, in the order they first became pending.
+     *
+     * Signals that receive new deferred events while the queue is flushing are queued
+     * again and handled by the next `flush()`, so a flush always terminates.
+     *
+     * The queue also keeps a list of every signal attached to it, pending or not,
+     * so destroying the queue first detaches them all.
+     */
+    class deferred_queue {
+    public:
+        /**
+         * @brief Constructs an empty queue.
+         * @since 1.2.0
+         */
+        deferred_queue() = default;
+
+        /**
+         * @brief Detaches every attached signal from the queue.
+         * @since 1.2.0
+         *
+         * The signals continue without a queue, as if `set_queue(nullptr)` had been called.
+         * Pending events stay stored in their signals and can still be flushed directly.
+         */
+        ~deferred_queue() {
+            attached.sever_all();
+        }
+
+        deferred_queue(const deferred_queue&) = delete;
+        deferred_queue& operator=(const deferred_queue&) = delete;
+
+        /**
+         * @brief Flushes every signal that was pending when the call started.
+         * @since 1.2.0
+         *
+         * The pending list is moved into a local batch first, so signals queued again
+         * by callbacks during the flush are left for the next call.
+         *
+         * @return The number of signals that were flushed.
+         */
+        unsigned int flush() {
+            if (!pending.linked()) {
+                return 0;
+            }
+
+            detail::deferred_link batch;
+            batch.next = pending.next;
+            batch.previous = pending.previous;
+            batch.next->previous = &batch;
+            batch.previous->next = &batch;
+            pending.next = &pending;
+            pending.previous = &pending;
+
+            unsigned int flushed = 0;
+            while (batch.linked()) {
+                detail::deferred_link* node = batch.next;
+                node->unlink();
+                node->flush(node->owner);
+                flushed++;
+            }
+            return flushed;
+        }
+
+        /**
+         * @brief Returns whether no signals are waiting to be flushed.
+         * @since 1.2.0
+         */
+        bool empty() const {
+            return !pending.linked();
+        }
+
+    private:
+        template<typename... arguments>
+        friend class deferred_signal;
+
+        /**
+         * @brief Sentinel of the circular list of signals with pending events.
+         * @since 1.2.0
+         */
+        detail::deferred_link pending;
+
+        /**
+         * @brief Every signal attached to the queue, severed by the destructor.
+         * @since 1.2.0
+         */
+        detail::link_list attached;
+    };
+
+    /**
+     * @brief A signal that can record events now and dispatch them later in one batch.
+     * @since 1.2.0
+     *
+     * `fire_deferred()` stores the arguments in an internal `event_log` instead of invoking
+     * callbacks, and `flush()` replays them through the ordinary `fire()`. With the default
+     * `keep_last` policy, any number of deferred fires between two flushes cost subscribers
+     * a single invocation carrying the most recent arguments.
+     *
+     * When attached to a `deferred_queue`, the signal enqueues itself on the first deferred
+     * fire after a flush, so one `deferred_queue::flush()` per frame dispatches all of them.
+     *
+     * Immediate `fire()` remains available and bypasses the pending events entirely.
+     *
+     * @tparam arguments The argument types forwarded to each callback upon firing.
+     */
+    template<typename... arguments>
+    class deferred_signal : public signal<arguments...> {
+    public:
+        /**
+         * @brief Constructs a deferred signal with the given policy and optional queue.
+         * @since 1.2.0
+         *
+         * @param policy How deferred fires between two flushes are coalesced.
+         * @param target Queue to enqueue into when events become pending, or nullptr to flush manually.
+         */
+        explicit deferred_signal(coalesce_policy policy = coalesce_policy::keep_last, deferred_queue* target = nullptr)
+            : pending(policy), queue(nullptr) {
+            link.owner = this;
+            link.flush = [](void* owner) {
+                static_cast<deferred_signal*>(owner)->flush();
+            };
+            attachment.previous = nullptr;
+            set_queue(target);
+        }
+
+        /**
+         * @brief Removes the signal from its queue before it is destroyed.
+         * @since 1.2.0
+         */
+        ~deferred_signal() {
+            set_queue(nullptr);
+        }
+
+        deferred_signal(const deferred_signal&) = delete;
+        deferred_signal& operator=(const deferred_signal&) = delete;
+
+        /**
+         * @brief Records an event to be dispatched by the next flush.
+         * @since 1.2.0
+         *
+         * The event is coalesced with other pending events according to the signal's policy.
+         * If the signal is attached to a queue and was not pending yet, it is enqueued.
+         *
+         * @param args The event arguments to record.
+         * @return `true` if the event was recorded or coalesced, `false` if the event log is full.
+         */
+        bool fire_deferred(arguments... args) {
+            if (!pending.record(args...)) {
+                return false;
+            }
+
+            if (queue && !link.linked()) {
+                queue->pending.push_back(&link);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Dispatches every pending event through `fire()` and removes the signal from its queue.
+         * @since 1.2.0
+         *
+         * @return The number of times `fire()` was called.
+         */
+        unsigned int flush() {
+            link.unlink();
+            return pending.replay(*this);
+        }
+
+        /**
+         * @brief Drops every pending event without dispatching it.
+         * @since 1.2.0
+         */
+        void discard() {
+            link.unlink();
+            pending.clear();
+        }
+
+        /**
+         * @brief Changes how future deferred fires are coalesced.
+         * @since 1.2.0
+         *
+         * @param policy The policy to apply from now on.
+         */
+        void set_policy(coalesce_policy policy) {
+            pending.set_policy(policy);
+        }
+
+        /**
+         * @brief Attaches the signal to a different queue, or detaches it when given nullptr.
+         * @since 1.2.0
+         *
+         * If events are pending, the signal moves to the new queue immediately.
+         *
+         * @param new_queue The queue to use from now on.
+         */
+        void set_queue(deferred_queue* new_queue) {
+            link.unlink();
+            if (attachment.previous) {
+                detail::unlink(attachment);
+            }
+
+            queue = new_queue;
+            if (queue) {
+                queue->attached.push(attachment, this, &deferred_signal::detach);
+                if (!pending.empty()) {
+                    queue->pending.push_back(&link);
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of events waiting for the next flush.
+         * @since 1.2.0
+         */
+        unsigned int pending_count() const {
+            return pending.size();
+        }
+
+    private:
+        /**
+         * @brief Events recorded by `fire_deferred()` since the last flush.
+         * @since 1.2.0
+         */
+        event_log<arguments...> pending;
+
+        /**
+         * @brief Queue this signal enqueues itself into, or nullptr.
+         * @since 1.2.0
+         */
+        deferred_queue* queue;
+
+        /**
+         * @brief Node linking this signal into its queue's pending list.
+         * @since 1.2.0
+         */
+        detail::deferred_link link;
+
+        /**
+         * @brief Node linking this signal into its queue's list of attached signals.
+         * @since 1.2.0
+         */
+        detail::track_link attachment;
+
+        /**
+         * @brief Detaches a signal from its queue on behalf of the queue's destructor.
+         * @since 1.2.0
+         */
+        static void detach(void* subject) {
+            static_cast<deferred_signal*>(subject)->set_queue(nullptr);
+        }
+    };
+
+    /**
+     * @brief Selects which end of a burst a `debounced_signal` fires on.
+     * @since 1.2.0
+     *
+     * - `leading` fires the first event of a burst right away and drops the rest.
+     * - `trailing` fires the last event of a burst once it has been quiet for the debounce period.
+     * - `both` does both, the trailing fire only happening if the burst had more than one event.
+     */
+    enum class debounce_edge {
+        leading,
+        trailing,
+        both
+    };
+
+    /**
+     * @brief A signal that collapses bursts of events into one fire per burst.
+     * @since 1.2.0
+     *
+     * `fire_debounced()` treats events less than the quiet period apart as one burst.
+     * Depending on the `debounce_edge`, the burst's first event is fired immediately and/or
+     * its last event is kept and fired once no event arrived for the quiet period. Time is
+     * read from the injected `monotonic_clock`, and the trailing fire happens in `poll()`
+     * (or the next `fire_debounced()`), which the application calls regularly, for example
+     * once per frame.
+     *
+     * Immediate `fire()` remains available and bypasses the debouncing entirely.
+     *
+     * @note Argument types are stored by value with references and `const` removed,
+     *       so they must be default constructible and copy assignable.
+     *
+     * @tparam arguments The argument types forwarded to each callback upon firing.
+     */
+    template<typename... arguments>
+    class debounced_signal : public signal<arguments...> {
+    public:
+        /**
+         * @brief Constructs a debounced signal.
+         * @since 1.2.0
+         *
+         * @param source The time source.
+         * @param quiet_ticks Number of clock ticks without events that ends a burst.
+         * @param fired_edge Which end of a burst is fired.
+         */
+        debounced_signal(monotonic_clock source, timer_ticks quiet_ticks,
+                         debounce_edge fired_edge = debounce_edge::trailing)
+            : clock(source), quiet(quiet_ticks), last_event(0), edge(fired_edge), bursting(false), pending(false) {}
+
+        debounced_signal(const debounced_signal&) = delete;
+        debounced_signal& operator=(const debounced_signal&) = delete;
+
+        /**
+         * @brief Records an event, firing it now if it starts a burst and the leading edge is enabled.
+         * @since 1.2.0
+         *
+         * A trailing event of a previous burst that is already due is fired first.
+         * Otherwise the arguments replace those of any pending trailing event.
+         *
+         * @param args The event arguments.
+         */
+        void fire_debounced(arguments... args) {
+            poll();
+
+            bool leading = edge != debounce_edge::trailing;
+            bool starts = !bursting;
+            bursting = true;
+            last_event = clock.now(clock.user);
+
+            if (starts && leading) {
+                this->fire(args...);
+            } else if (edge != debounce_edge::leading) {
+                last.store(args...);
+                pending = true;
+            }
+        }
+
+        /**
+         * @brief Ends the current burst if it has been quiet long enough, firing its trailing event.
+         * @since 1.2.0
+         *
+         * @return `true` if a trailing event was fired.
+         */
+        bool poll() {
+            if (!bursting || clock.now(clock.user) - last_event < quiet) {
+                return false;
+            }
+
+            bursting = false;
+            return flush();
+        }
+
+        /**
+         * @brief Fires the pending trailing event now, without waiting for the burst to end.
+         * @since 1.2.0
+         *
+         * @return `true` if an event was pending.
+         */
+        bool flush() {
+            if (!pending) {
+                return false;
+            }
+
+            pending = false;
+            detail::argument_pack<arguments...> event = last;
+            event.fire_into(*this);
+            return true;
+        }
+
+        /**
+         * @brief Drops the pending trailing event and ends the current burst.
+         * @since 1.2.0
+         */
+        void discard() {
+            pending = false;
+            bursting = false;
+        }
+
+        /**
+         * @brief Returns whether a trailing event is waiting to be fired.
+         * @since 1.2.0
+         */
+        bool has_pending() const {
+            return pending;
+        }
+
+    private:
+        /**
+         * @brief The time source.
+         * @since 1.2.0
+         */
+        monotonic_clock clock;
+
+        /**
+         * @brief Number of clock ticks without events that ends a burst.
+         * @since 1.2.0
+         */
+        timer_ticks quiet;
+
+        /**
+         * @brief Time of the most recent `fire_debounced()`.
+         * @since 1.2.0
+         */
+        timer_ticks last_event;
+
+        /**
+         * @brief Arguments of the pending trailing event.
+         * @since 1.2.0
+         */
+        detail::argument_pack<arguments...> last;
+
+        /**
+         * @brief Which end of a burst is fired.
+         * @since 1.2.0
+         */
+        debounce_edge edge;
+
+        /**
+         * @brief Whether a burst is in progress.
+         * @since 1.2.0
+         */
+        bool bursting;
+
+        /**
+         * @brief Whether `last` holds an event that still has to be fired.
+         * @since 1.2.0
+         */
+        bool pending;
+    };
+
+    /**
+     * @brief A signal that fires at most once per interval.
+     * @since 1.2.0
+     *
+     * `fire_throttled()` fires right away when at least one interval has passed since the
+     * previous fire. Otherwise the event is dropped, or, with trailing fires enabled, kept
+     * (the latest one wins) and fired by `poll()` or the next `fire_throttled()` as soon as
+     * the interval is over. Time is read from the injected `monotonic_clock`.
+     *
+     * Immediate `fire()` remains available and is not counted against the rate.
+     *
+     * @note Argument types are stored by value with references and `const` removed,
+     *       so they must be default constructible and copy assignable.
+     *
+     * @tparam arguments The argument types forwarded to each callback upon firing.
+     */
+    template<typename... arguments>
+    class throttled_signal : public signal<arguments...> {
+    public:
+        /**
+         * @brief Constructs a throttled signal.
+         * @since 1.2.0
+         *
+         * @param source The time source.
+         * @param interval_ticks Minimum number of clock ticks between two throttled fires.
+         * @param keep_trailing Whether events arriving too early are kept and fired later instead of dropped.
+         */
+        throttled_signal(monotonic_clock source, timer_ticks interval_ticks, bool keep_trailing = true)
+            : clock(source), interval(interval_ticks), last_fire(0), trailing(keep_trailing), started(false),
+              pending(false) {}
+
+        throttled_signal(const throttled_signal&) = delete;
+        throttled_signal& operator=(const throttled_signal&) = delete;
+
+        /**
+         * @brief Fires the event now if the rate allows it, otherwise keeps or drops it.
+         * @since 1.2.0
+         *
+         * @param args The event arguments.
+         * @return `true` if the event was fired immediately.
+         */
+        bool fire_throttled(arguments... args) {
+            poll();
+
+            timer_ticks now = clock.now(clock.user);
+            if (!started || now - last_fire >= interval) {
+                started = true;
+                last_fire = now;
+                pending = false;
+                this->fire(args...);
+                return true;
+            }
+
+            if (trailing) {
+                last.store(args...);
+                pending = true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Fires the kept event if the interval since the previous throttled fire is over.
+         * @since 1.2.0
+         *
+         * @return `true` if an event was fired.
+         */
+        bool poll() {
+            if (!pending) {
+                return false;
+            }
+
+            timer_ticks now = clock.now(clock.user);
+            if (now - last_fire < interval) {
+                return false;
+            }
+
+            pending = false;
+            last_fire = now;
+            detail::argument_pack<arguments...> event = last;
+            event.fire_into(*this);
+            return true;
+        }
+
+        /**
+         * @brief Drops the kept event.
+         * @since 1.2.0
+         */
+        void discard() {
+            pending = false;
+        }
+
+        /**
+         * @brief Returns whether an event is waiting for the interval to end.
+         * @since 1.2.0
+         */
+        bool has_pending() const {
+            return pending;
+        }
+
+    private:
+        /**
+         * @brief The time source.
+         * @since 1.2.0
+         */
+        monotonic_clock clock;
+
+        /**
+         * @brief Minimum number of clock ticks between two throttled fires.
+         * @since 1.2.0
+         */
+        timer_ticks interval;
+
+        /**
+         * @brief Time of the previous throttled fire.
+         * @since 1.2.0
+         */
+        timer_ticks last_fire;
+
+        /**
+         * @brief Arguments of the kept event.
+         * @since 1.2.0
+         */
+        detail::argument_pack<arguments...> last;
+
+        /**
+         * @brief Whether events arriving too early are kept.
+         * @since 1.2.0
+         */
+        bool trailing;
+
+        /**
+         * @brief Whether a throttled fire happened yet.
+         * @since 1.2.0
+         */
+        bool started;
+
+        /**
+         * @brief Whether `last` holds an event that still has to be fired.
+         * @since 1.2.0
+         */
+        bool pending;
+    };
+
+    /**
+     * @brief A signal whose dispatch can be spread over several calls to bound the time spent per call.
+     * @since 1.2.0
+     *
+     * `fire_incremental()` stores the arguments, starts a pass over the subscribers and runs
+     * callbacks until the `dispatch_budget` is used; `advance()` continues the pass from where
+     * it stopped, for example once per frame, until it returns `true`.
+     *
+     * A pass has snapshot semantics with respect to the set of connections:
+     * - It reaches the connections that were connected when it started, in dispatch order,
+     *   the one-shot ring included.
+     * - Connections disconnected or blocked before their turn are skipped.
+     * - Connections made while the pass is open, by its callbacks or between calls, are not
+     *   reached by it; they are first invoked by the next pass or `fire()`.
+     *
+     * The pass remembers its position by the priority and sequence of the last connection it
+     * reached, so between calls the signal is not held: disconnected entries are compacted,
+     * vacant slots are reused and immediate `fire()` reaches every connection, including those
+     * made during the pass, independently of it. A frozen signal's dispatch plan is not used,
+     * forwarding connections fire their target in full as one step, and a suspended signal
+     * pauses the pass until it is resumed.
+     *
+     * @note Argument types are stored by value with references and `const` removed,
+     *       so they must be default constructible and copy assignable.
+     *
+     * @tparam arguments The argument types forwarded to each callback upon firing.
+     */
+    template<typename... arguments>
+    class incremental_signal : public signal<arguments...> {
+    public:
+        /**
+         * @brief Constructs an incremental signal with no pass in progress.
+         * @since 1.2.0
+         */
+        incremental_signal() : open(false), running(false) {}
+
+        incremental_signal(const incremental_signal&) = delete;
+        incremental_signal& operator=(const incremental_signal&) = delete;
+
+        /**
+         * @brief Destructor ending the open pass, if any, without running its remaining callbacks.
+         * @since 1.2.0
+         */
+        ~incremental_signal() {
+            discard();
+        }
+
+        /**
+         * @brief Starts a dispatch pass with the given arguments and runs it until the budget is used.
+         * @since 1.2.0
+         *
+         * Events never overtake each other: if the previous pass is still open, it is first
+         * run to its end regardless of the budget. Call `advance()` until `has_pending()`
+         * returns `false` to keep every call within the budget. While the signal is suspended
+         * the event is handled as by `fire()` and no pass is started. Called from one of the
+         * open pass's own callbacks, the event is dropped.
+         *
+         * @param args The argument pack forwarded to each callback function.
+         * @param budget Limit of this call.
+         * @return `true` if every subscriber was reached, `false` if the pass continues in `advance()`.
+         */
+        bool fire_incremental(arguments... args, dispatch_budget budget) {
+            if (running) {
+                return false;
+            }
+            if (!this->active) {
+                this->fire(args...);
+                return true;
+            }
+            if (open) {
+                advance(callback_budget(0));
+            }
+
+            values.store(args...);
+            this->open_pass(cursor);
+            open = true;
+            return advance(budget);
+        }
+
+        /**
+         * @brief Continues the open pass until the budget is used.
+         * @since 1.2.0
+         *
+         * Does nothing when called from one of the pass's own callbacks or while the signal
+         * is suspended.
+         *
+         * @param budget Limit of this call.
+         * @return `true` if no pass is open anymore.
+         */
+        bool advance(dispatch_budget budget) {
+            if (!open) {
+                return true;
+            }
+            if (running || !this->active) {
+                return false;
+            }
+
+            running = true;
+            finish_into pass = { this, &budget, false };
+            values.fire_into(pass);
+            running = false;
+
+            if (pass.finished) {
+                open = false;
+            }
+            return pass.finished;
+        }
+
+        /**
+         * @brief Ends the open pass without running its remaining callbacks.
+         * @since 1.2.0
+         *
+         * Has no effect when called from one of the pass's own callbacks.
+         */
+        void discard() {
+            if (open && !running) {
+                open = false;
+            }
+        }
+
+        /**
+         * @brief Returns whether a pass is open and has subscribers left to reach.
+         * @since 1.2.0
+         */
+        bool has_pending() const {
+            return open;
+        }
+
+    private:
+        /**
+         * @brief Target of `detail::argument_pack::fire_into()` that continues the pass with the stored arguments.
+         * @since 1.2.0
+         */
+        struct finish_into {
+            void fire(arguments... args) {
+                finished = owner->run_pass(owner->cursor, *budget, args...);
+            }
+
+            incremental_signal* owner;
+            const dispatch_budget* budget;
+            bool finished;
+        };
+
+        /**
+         * @brief Arguments of the open pass.
+         * @since 1.2.0
+         */
+        detail::argument_pack<arguments...> values;
+
+        /**
+         * @brief Position of the open pass.
+         * @since 1.2.0
+         */
+        detail::dispatch_cursor cursor;
+
+        /**
+         * @brief Whether a pass is open.
+         * @since 1.2.0
+         */
+        bool open;
+
+        /**
+         * @brief Whether the pass is currently running callbacks.
+         * @since 1.2.0
+         */
+        bool running;
+    };
+
+    /**
+     * @brief Hash function used by `keyed_signal` to place keys into its hash table.
+     * @since 1.2.0
+     *
+     * The primary template converts the key to an unsigned integer, which covers integral
+     * and enumeration types. Pointers hash their address. Other key types must provide a
+     * specialization with a static `hash()` member and be comparable with `==`.
+     *
+     * @tparam key_type The type of key to hash.
+     */
+    template<typename key_type>
+    struct key_hash {
+        static detail::size_type hash(const key_type& key) {
+            return static_cast<detail::size_type>(key);
+        }
+    };
+
+    template<typename key_type>
+    struct key_hash<key_type*> {
+        static detail::size_type hash(key_type* key) {
+            return reinterpret_cast<detail::size_type>(key);
+        }
+    };
+
+    /**
+     * @brief A signal whose subscribers listen to one specific key instead of every event.
+     * @since 1.2.0
+     *
+     * Subscribers connect with the key they are interested in, and `fire(key, args...)`
+     * only invokes the subscribers of that key (found through an open-addressing hash table),
+     * followed by the wildcard subscribers registered with `connect_any()`. Dispatch cost is
+     * therefore proportional to the number of interested subscribers, not to all of them.
+     *
+     * Callbacks receive the key as their first argument after the context, so a callback
+     * written for a plain `signal<key_type, arguments...>` can be connected unchanged.
+     *
+     * All subscribers share one fixed pool of `CPP_CONNECTIONS_MAX_CONNECTIONS` connections,
+     * and at most `CPP_CONNECTIONS_MAX_KEYS` distinct keys can have subscribers at once.
+     * Each key's subscribers run in the order they were connected.
+     *
+     * @tparam key_type The key type; see `key_hash` for its requirements.
+     * @tparam arguments The remaining argument types forwarded to each callback upon firing.
+     */
+    template<typename key_type, typename... arguments>
+    class keyed_signal {
+    public:
+        /**
+         * @brief Constructs an active keyed signal with no subscribers.
+         * @since 1.2.0
+         */
+        keyed_signal() : active(true), firing(0), removed_buckets(0), wildcard_head(-1), wildcard_tail(-1) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                nodes[i].connected = false;
+                nodes[i].owner = nullptr;
+                nodes[i].links = nullptr;
+                owner[i] = free_node;
+            }
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_KEYS; ++i) {
+                buckets[i].state = bucket_empty;
+            }
+        }
+
+        /**
+         * @brief Disconnects every subscriber before the signal is destroyed.
+         * @since 1.2.0
+         */
+        ~keyed_signal() {
+            disconnect_all();
+        }
+
+        keyed_signal(const keyed_signal&) = delete;
+        keyed_signal& operator=(const keyed_signal&) = delete;
+
+        /**
+         * @brief Registers a persistent callback for a single key.
+         * @since 1.2.0
+         *
+         * @param key The key the callback is interested in.
+         * @param function Pointer to the callback function to invoke when `key` is fired.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if no connection or key slot is free.
+         */
+        connection<key_type, arguments...>* connect(key_type key, void (*function)(void* context, key_type, arguments...), void* context) {
+            return attach(&key, function, context, false);
+        }
+
+        /**
+         * @brief Registers a one-shot callback for a single key.
+         * @since 1.2.0
+         *
+         * @param key The key the callback is interested in.
+         * @param function Pointer to the callback function to invoke the next time `key` is fired.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if no connection or key slot is free.
+         */
+        connection<key_type, arguments...>* once(key_type key, void (*function)(void* context, key_type, arguments...), void* context) {
+            return attach(&key, function, context, true);
+        }
+
+        /**
+         * @brief Registers a persistent callback invoked for every key.
+         * @since 1.2.0
+         *
+         * Wildcard subscribers run after the subscribers of the fired key.
+         *
+         * @param function Pointer to the callback function to invoke on every fire.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if no connection slot is free.
+         */
+        connection<key_type, arguments...>* connect_any(void (*function)(void* context, key_type, arguments...), void* context) {
+            return attach(nullptr, function, context, false);
+        }
+
+        /**
+         * @brief Registers a one-shot callback invoked for the next fire of any key.
+         * @since 1.2.0
+         *
+         * @param function Pointer to the callback function to invoke on the next fire.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if no connection slot is free.
+         */
+        connection<key_type, arguments...>* once_any(void (*function)(void* context, key_type, arguments...), void* context) {
+            return attach(nullptr, function, context, true);
+        }
+
+        /**
+         * @brief Disconnects every subscriber of the given key.
+         * @since 1.2.0
+         *
+         * Wildcard subscribers are not affected.
+         *
+         * @param key The key whose subscribers are disconnected.
+         */
+        void disconnect_key(key_type key) {
+            int index = find_bucket(key);
+            if (index < 0) {
+                return;
+            }
+
+            for (int node = buckets[index].head; node >= 0; node = next[node]) {
+                nodes[node].disconnect();
+            }
+            if (firing == 0) {
+                sweep(index);
+            }
+        }
+
+        /**
+         * @brief Disconnects every keyed and wildcard subscriber.
+         * @since 1.2.0
+         */
+        void disconnect_all() {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                nodes[i].disconnect();
+            }
+            if (firing == 0) {
+                sweep_all();
+            }
+        }
+
+        /**
+         * @brief Disconnects every subscriber whose callback matches the given pointer.
+         * @since 1.2.0
+         *
+         * @param callback The callback function pointer to match and disconnect.
+         */
+        void disconnect_by_callback(void (*callback)(void*, key_type, arguments...)) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                if (nodes[i].connected && nodes[i].callback == callback) {
+                    nodes[i].disconnect();
+                }
+            }
+            if (firing == 0) {
+                sweep_all();
+            }
+        }
+
+        /**
+         * @brief Disconnects every subscriber whose context matches the given pointer.
+         * @since 1.2.0
+         *
+         * @param context The user-defined context pointer to match and disconnect.
+         */
+        void disconnect_by_context(void* context) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                if (nodes[i].connected && nodes[i].context == context) {
+                    nodes[i].disconnect();
+                }
+            }
+            if (firing == 0) {
+                sweep_all();
+            }
+        }
+
+        /**
+         * @brief Suspends the signal, preventing any callbacks from being invoked during `fire()`.
+         * @since 1.2.0
+         */
+        void suspend() {
+            active = false;
+        }
+
+        /**
+         * @brief Resumes the signal, allowing callbacks to be invoked normally during `fire()`.
+         * @since 1.2.0
+         */
+        void resume() {
+            active = true;
+        }
+
+        /**
+         * @brief Fires the signal for one key, invoking that key's subscribers and then the wildcard subscribers.
+         * @since 1.2.0
+         *
+         * Only the subscriber list of `key` is visited, so keys nobody listens to cost
+         * one hash lookup. Connections added by callbacks during the fire are not invoked
+         * until the next fire. Disconnected entries are unlinked from their lists as the
+         * outermost fire passes over them.
+         *
+         * @param key The key to dispatch.
+         * @param args The argument pack forwarded to each callback function.
+         */
+        void fire(key_type key, arguments... args) {
+            if (!active) {
+                return;
+            }
+
+            firing++;
+
+            int index = find_bucket(key);
+            if (index >= 0) {
+                dispatch(buckets[index].head, buckets[index].tail, key, args...);
+                if (firing == 1 && buckets[index].head < 0) {
+                    release_bucket(index);
+                }
+            }
+            dispatch(wildcard_head, wildcard_tail, key, args...);
+
+            firing--;
+        }
+
+        /**
+         * @brief Returns the number of connected subscribers of the given key, excluding wildcards.
+         * @since 1.2.0
+         *
+         * @param key The key to count subscribers for.
+         * @return The count of connected callbacks registered for `key`.
+         */
+        unsigned int connection_count(key_type key) const {
+            int index = find_bucket(key);
+            unsigned int count = 0;
+
+            for (int node = index >= 0 ? buckets[index].head : -1; node >= 0; node = next[node]) {
+                if (nodes[node].connected) {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Returns the number of connected subscribers across all keys, including wildcards.
+         * @since 1.2.0
+         */
+        unsigned int connection_count() const {
+            unsigned int count = 0;
+
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                if (nodes[i].connected) {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Returns the compile-time maximum number of connections shared by all keys.
+         * @since 1.2.0
+         */
+        int max_connections() const {
+            return CPP_CONNECTIONS_MAX_CONNECTIONS;
+        }
+
+        /**
+         * @brief Returns the compile-time maximum number of distinct keys with subscribers.
+         * @since 1.2.0
+         */
+        int max_keys() const {
+            return CPP_CONNECTIONS_MAX_KEYS;
+        }
+
+    private:
+        /**
+         * @brief `owner` value of a connection that is not linked into any list.
+         * @since 1.2.0
+         */
+        static const int free_node = -1;
+
+        /**
+         * @brief `owner` value of a connection linked into the wildcard list.
+         * @since 1.2.0
+         */
+        static const int wildcard_node = -2;
+
+        static const unsigned char bucket_empty = 0;
+        static const unsigned char bucket_used = 1;
+        static const unsigned char bucket_removed = 2;
+
+        /**
+         * @brief Hash table entry holding one key and its subscriber list.
+         * @since 1.2.0
+         */
+        struct bucket {
+            key_type key;
+            int head;
+            int tail;
+            unsigned char state;
+        };
+
+        static detail::size_type slot_of(const key_type& key) {
+            detail::size_type hash = key_hash<key_type>::hash(key) * static_cast<detail::size_type>(0x9E3779B97F4A7C15ull);
+            return (hash ^ (hash >> 29)) & (CPP_CONNECTIONS_MAX_KEYS - 1);
+        }
+
+        int find_bucket(const key_type& key) const {
+            detail::size_type index = slot_of(key);
+
+            for (int probe = 0; probe < CPP_CONNECTIONS_MAX_KEYS; ++probe) {
+                const bucket& current = buckets[index];
+                if (current.state == bucket_empty) {
+                    return -1;
+                }
+                if (current.state == bucket_used && current.key == key) {
+                    return static_cast<int>(index);
+                }
+                index = (index + 1) & (CPP_CONNECTIONS_MAX_KEYS - 1);
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Claims a bucket for a key that has none.
+         * @since 1.2.0
+         *
+         * If every bucket is in use and no fire is running, the subscriber lists are swept
+         * first, which releases the buckets of keys whose subscribers all disconnected.
+         */
+        int insert_bucket(const key_type& key) {
+            for (int pass = 0; pass < 2; ++pass) {
+                if (firing == 0 && removed_buckets * 4 > CPP_CONNECTIONS_MAX_KEYS) {
+                    rehash();
+                }
+
+                detail::size_type index = slot_of(key);
+                for (int probe = 0; probe < CPP_CONNECTIONS_MAX_KEYS; ++probe) {
+                    bucket& current = buckets[index];
+                    if (current.state != bucket_used) {
+                        if (current.state == bucket_removed) {
+                            removed_buckets--;
+                        }
+                        current.key = key;
+                        current.head = -1;
+                        current.tail = -1;
+                        current.state = bucket_used;
+                        return static_cast<int>(index);
+                    }
+                    index = (index + 1) & (CPP_CONNECTIONS_MAX_KEYS - 1);
+                }
+
+                if (firing != 0) {
+                    break;
+                }
+                sweep_all();
+            }
+            return -1;
+        }
+
+        void release_bucket(int index) {
+            buckets[index].state = bucket_removed;
+            removed_buckets++;
+        }
+
+        /**
+         * @brief Re-inserts every used bucket to clear out removed (tombstone) entries.
+         * @since 1.2.0
+         */
+        void rehash() {
+            bucket previous[CPP_CONNECTIONS_MAX_KEYS];
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_KEYS; ++i) {
+                previous[i] = buckets[i];
+                buckets[i].state = bucket_empty;
+            }
+            removed_buckets = 0;
+
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_KEYS; ++i) {
+                if (previous[i].state != bucket_used) {
+                    continue;
+                }
+
+                detail::size_type index = slot_of(previous[i].key);
+                while (buckets[index].state == bucket_used) {
+                    index = (index + 1) & (CPP_CONNECTIONS_MAX_KEYS - 1);
+                }
+                buckets[index] = previous[i];
+                for (int node = buckets[index].head; node >= 0; node = next[node]) {
+                    owner[node] = static_cast<int>(index);
+                }
+            }
+        }
+
+        int allocate_node() {
+            for (int pass = 0; pass < 2; ++pass) {
+                for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                    if (owner[i] == free_node) {
+                        return i;
+                    }
+                }
+                if (firing != 0) {
+                    break;
+                }
+                sweep_all();
+            }
+            return -1;
+        }
+
+        connection<key_type, arguments...>* attach(const key_type* key, void (*function)(void*, key_type, arguments...), void* context, bool once) {
+            int node = allocate_node();
+            if (node < 0) {
+                return nullptr;
+            }
+
+            int list = wildcard_node;
+            if (key) {
+                list = find_bucket(*key);
+                if (list < 0) {
+                    list = insert_bucket(*key);
+                    if (list < 0) {
+                        return nullptr;
+                    }
+                }
+            }
+
+            nodes[node].connected = true;
+            nodes[node].once = once;
+            nodes[node].callback = function;
+            nodes[node].context = context;
+            nodes[node].links = nullptr;
+            owner[node] = list;
+            next[node] = -1;
+
+            int& head = list == wildcard_node ? wildcard_head : buckets[list].head;
+            int& tail = list == wildcard_node ? wildcard_tail : buckets[list].tail;
+            if (tail >= 0) {
+                next[tail] = node;
+            } else {
+                head = node;
+            }
+            tail = node;
+            return &nodes[node];
+        }
+
+        void unlink(int& head, int& tail, int previous, int node) {
+            if (previous >= 0) {
+                next[previous] = next[node];
+            } else {
+                head = next[node];
+            }
+            if (tail == node) {
+                tail = previous;
+            }
+            owner[node] = free_node;
+        }
+
+        /**
+         * @brief Unlinks every disconnected entry of one list, releasing its bucket once empty.
+         * @since 1.2.0
+         *
+         * @param list Bucket index, or `wildcard_node` for the wildcard list.
+         */
+        void sweep(int list) {
+            int& head = list == wildcard_node ? wildcard_head : buckets[list].head;
+            int& tail = list == wildcard_node ? wildcard_tail : buckets[list].tail;
+            int previous = -1;
+
+            for (int node = head; node >= 0;) {
+                int following = next[node];
+                if (nodes[node].connected) {
+                    previous = node;
+                } else {
+                    unlink(head, tail, previous, node);
+                }
+                node = following;
+            }
+
+            if (list != wildcard_node && head < 0) {
+                release_bucket(list);
+            }
+        }
+
+        void sweep_all() {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_KEYS; ++i) {
+                if (buckets[i].state == bucket_used) {
+                    sweep(i);
+                }
+            }
+            sweep(wildcard_node);
+        }
+
+        /**
+         * @brief Invokes one subscriber list, unlinking dead entries when this is the outermost fire.
+         * @since 1.2.0
+         *
+         * The walk stops at the entry that was the list's tail when it started, so entries
+         * appended by callbacks wait for the next fire.
+         */
+        void dispatch(int& head, int& tail, key_type key, arguments... args) {
+            if (head < 0) {
+                return;
+            }
+
+            int last = tail;
+            int previous = -1;
+            for (int node = head; node >= 0;) {
+                connection<key_type, arguments...>& current = nodes[node];
+                if (current.connected && current.callback && !current.muted()) {
+                    current.callback(current.context, key, args...);
+
+                    if (current.once) {
+                        current.disconnect();
+                    }
+                }
+
+                int following = next[node];
+                if (!current.connected && firing == 1) {
+                    unlink(head, tail, previous, node);
+                } else {
+                    previous = node;
+                }
+
+                if (node == last) {
+                    break;
+                }
+                node = following;
+            }
+        }
+
+        /**
+         * @brief Whether `fire()` currently dispatches callbacks.
+         * @since 1.2.0
+         */
+        bool active;
+
+        /**
+         * @brief Nesting depth of `fire()`; lists are only restructured while it is zero or one.
+         * @since 1.2.0
+         */
+        int firing;
+
+        /**
+         * @brief Number of removed (tombstone) buckets in the hash table.
+         * @since 1.2.0
+         */
+        int removed_buckets;
+
+        /**
+         * @brief First and last entry of the wildcard subscriber list.
+         * @since 1.2.0
+         */
+        int wildcard_head;
+        int wildcard_tail;
+
+        /**
+         * @brief Open-addressing hash table mapping keys to subscriber lists.
+         * @since 1.2.0
+         */
+        bucket buckets[CPP_CONNECTIONS_MAX_KEYS];
+
+        /**
+         * @brief Connection storage shared by every key; entries are stable while connected.
+         * @since 1.2.0
+         */
+        connection<key_type, arguments...> nodes[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Next entry in the same subscriber list, or -1.
+         * @since 1.2.0
+         */
+        int next[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Bucket index of the list holding each entry, `wildcard_node` or `free_node`.
+         * @since 1.2.0
+         */
+        int owner[CPP_CONNECTIONS_MAX_CONNECTIONS];
+    };
+
+    namespace detail {
+        inline unsigned int string_length(const char* text) {
+            unsigned int length = 0;
+            while (text[length]) {
+                length++;
+            }
+            return length;
+        }
+
+        inline bool strings_equal(const char* a, unsigned int a_length, const char* b, unsigned int b_length) {
+            if (a_length != b_length) {
+                return false;
+            }
+            for (unsigned int i = 0; i < a_length; ++i) {
+                if (a[i] != b[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief 32-bit FNV-1a hash of a character range.
+         * @since 1.2.0
+         */
+        inline unsigned int string_hash(const char* text, unsigned int length) {
+            unsigned int hash = 2166136261u;
+            for (unsigned int i = 0; i < length; ++i) {
+                hash = (hash ^ static_cast<unsigned char>(text[i])) * 16777619u;
+            }
+            return hash;
+        }
+    }
+
+    /**
+     * @brief Publish/subscribe bus for hierarchical, slash-separated topics such as `orders/42/filled`.
+     * @since 1.2.0
+     *
+     * Concrete topics are interned once into small integer IDs. Subscriptions use patterns
+     * stored in a trie, where a `*` segment matches exactly one topic segment and a trailing
+     * `#` segment matches any number of remaining segments (including none). Every distinct
+     * pattern owns one `signal<arguments...>` that its subscribers are connected to.
+     *
+     * The set of patterns matching a topic is computed the first time the topic is published
+     * and cached with it. The cache is invalidated only when a pattern is added or released,
+     * so publishing to an interned topic costs no string work at all: it fires the cached
+     * pattern signals in the order the patterns were created. A pattern that was released
+     * after losing its last subscriber counts as new when it is subscribed to again.
+     *
+     * Capacity is fixed: `CPP_CONNECTIONS_MAX_TOPICS` interned topics,
+     * `CPP_CONNECTIONS_MAX_PATTERNS` live patterns, `CPP_CONNECTIONS_MAX_TRIE_NODES`
+     * trie nodes and `CPP_CONNECTIONS_TOPIC_CHARACTERS` characters of topic and pattern text.
+     * Interned topics are never released. Trie nodes left without a pattern or children
+     * by a released pattern are pruned, and the characters of pruned segments are reused
+     * once the character storage runs full.
+     *
+     * @tparam arguments The argument types forwarded to each callback upon publishing.
+     */
+    template<typename... arguments>
+    class topic_bus {
+    public:
+        /**
+         * @brief Constructs an empty bus.
+         * @since 1.2.0
+         */
+        topic_bus() : generation(1), patterns_created(0), topics_used(0), nodes_used(1), vacant_nodes(-1), characters_used(0), publishing(0),
+                      release_pending(false) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_TOPICS * 2; ++i) {
+                topic_table[i] = -1;
+            }
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_PATTERNS; ++i) {
+                patterns[i].node = -1;
+            }
+            nodes[0].text = 0;
+            nodes[0].length = 0;
+            nodes[0].first_child = -1;
+            nodes[0].next_sibling = -1;
+            nodes[0].parent = -1;
+            nodes[0].pattern = -1;
+        }
+
+        topic_bus(const topic_bus&) = delete;
+        topic_bus& operator=(const topic_bus&) = delete;
+
+        /**
+         * @brief Returns the ID of a concrete topic, interning it if it is new.
+         * @since 1.2.0
+         *
+         * IDs are stable for the lifetime of the bus. Hot publishers should intern
+         * their topics once and publish by ID.
+         *
+         * @param topic The concrete topic name, without wildcards.
+         * @return The topic ID, or -1 if the topic table or character storage is full.
+         */
+        int intern(const char* topic) {
+            unsigned int length = detail::string_length(topic);
+            unsigned int hash = detail::string_hash(topic, length);
+            unsigned int index = hash & (CPP_CONNECTIONS_MAX_TOPICS * 2 - 1);
+
+            while (topic_table[index] >= 0) {
+                const topic_entry& existing = topics[topic_table[index]];
+                if (existing.hash == hash && detail::strings_equal(characters + existing.text, existing.length, topic, length)) {
+                    return topic_table[index];
+                }
+                index = (index + 1) & (CPP_CONNECTIONS_MAX_TOPICS * 2 - 1);
+            }
+
+            if (topics_used == CPP_CONNECTIONS_MAX_TOPICS) {
+                return -1;
+            }
+
+            int text = store(topic, length);
+            if (text < 0) {
+                return -1;
+            }
+
+            int id = topics_used++;
+            topics[id].text = static_cast<unsigned int>(text);
+            topics[id].length = length;
+            topics[id].hash = hash;
+            topics[id].generation = 0;
+            topics[id].match_count = 0;
+            topic_table[index] = id;
+            return id;
+        }
+
+        /**
+         * @brief Returns the name of an interned topic.
+         * @since 1.2.0
+         *
+         * @param topic A topic ID returned by `intern()`.
+         * @return The null-terminated topic name, or nullptr for an invalid ID.
+         */
+        const char* topic_name(int topic) const {
+            return topic >= 0 && topic < topics_used ? characters + topics[topic].text : nullptr;
+        }
+
+        /**
+         * @brief Connects a callback to every topic matching the given pattern.
+         * @since 1.2.0
+         *
+         * Creating a new pattern invalidates the cached matches of all topics;
+         * subscribing to an existing pattern does not. Patterns whose subscribers all
+         * disconnected through their handles keep their slot until one is needed here.
+         *
+         * @param pattern Slash-separated pattern; `*` matches one segment and a final `#` any remainder.
+         * @param function Pointer to the callback function to invoke on matching publishes.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if the pattern is malformed or capacity is exhausted.
+         */
+        connection<arguments...>* subscribe(const char* pattern, void (*function)(void* context, arguments...), void* context) {
+            int node = find_node(pattern, true);
+            if (node < 0) {
+                return nullptr;
+            }
+
+            if (nodes[node].pattern < 0) {
+                int slot = vacant_pattern();
+                if (slot < 0) {
+                    release_empty_patterns();
+                    slot = vacant_pattern();
+                }
+                if (slot < 0) {
+                    prune(node);
+                    return nullptr;
+                }
+
+                patterns[slot].node = node;
+                patterns[slot].created = patterns_created++;
+                nodes[node].pattern = slot;
+                generation++;
+            }
+
+            return patterns[nodes[node].pattern].channel.connect(function, context);
+        }
+
+        /**
+         * @brief Disconnects every subscriber of the given pattern and releases it.
+         * @since 1.2.0
+         *
+         * @param pattern The exact pattern text used when subscribing.
+         */
+        void unsubscribe(const char* pattern) {
+            int node = find_node(pattern, false);
+            if (node >= 0 && nodes[node].pattern >= 0) {
+                patterns[nodes[node].pattern].channel.disconnect_all();
+                release_empty_patterns();
+            }
+        }
+
+        /**
+         * @brief Disconnects every subscriber with the given context from all patterns.
+         * @since 1.2.0
+         *
+         * Patterns left without subscribers are released.
+         *
+         * @param context The user-defined context pointer to match and disconnect.
+         */
+        void unsubscribe_by_context(void* context) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_PATTERNS; ++i) {
+                if (patterns[i].node >= 0) {
+                    patterns[i].channel.disconnect_by_context(context);
+                }
+            }
+            release_empty_patterns();
+        }
+
+        /**
+         * @brief Publishes an event to an interned topic.
+         * @since 1.2.0
+         *
+         * Fires the signal of every pattern matching the topic. The matching patterns
+         * are taken from the topic's cache, which is rebuilt first if patterns were
+         * added or released since it was computed.
+         *
+         * @param topic A topic ID returned by `intern()`.
+         * @param args The argument pack forwarded to each callback function.
+         * @return `true` if the ID is valid, `false` otherwise.
+         */
+        bool publish(int topic, arguments... args) {
+            if (topic < 0 || topic >= topics_used) {
+                return false;
+            }
+
+            topic_entry& entry = topics[topic];
+            if (entry.generation != generation) {
+                collect_matches(entry);
+            }
+
+            publishing++;
+            for (unsigned int i = 0; i < entry.match_count; ++i) {
+                patterns[entry.matches[i]].channel.fire(args...);
+            }
+            publishing--;
+
+            if (publishing == 0 && release_pending) {
+                release_empty_patterns();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Interns a topic by name and publishes an event to it.
+         * @since 1.2.0
+         *
+         * Convenient for cold paths; hot paths should keep the ID from `intern()`.
+         *
+         * @param topic The concrete topic name.
+         * @param args The argument pack forwarded to each callback function.
+         * @return `true` if the topic could be interned, `false` otherwise.
+         */
+        bool publish(const char* topic, arguments... args) {
+            return publish(intern(topic), args...);
+        }
+
+    private:
+        /**
+         * @brief One interned concrete topic and its cached matching patterns.
+         * @since 1.2.0
+         */
+        struct topic_entry {
+            unsigned int text;
+            unsigned int length;
+            unsigned int hash;
+            unsigned int generation;
+            unsigned int match_count;
+            unsigned char matches[CPP_CONNECTIONS_MAX_PATTERNS];
+        };
+
+        /**
+         * @brief One pattern segment in the subscription trie.
+         * @since 1.2.0
+         */
+        struct trie_node {
+            unsigned int text;
+            unsigned int length;
+            int first_child;
+
+            /**
+             * @brief Next child of the same parent, or the next vacant node while the node is unused.
+             * @since 1.2.0
+             */
+            int next_sibling;
+
+            /**
+             * @brief Parent node, or -1 for the root and for vacant nodes.
+             * @since 1.2.0
+             */
+            int parent;
+            int pattern;
+        };
+
+        /**
+         * @brief A live pattern and the signal its subscribers are connected to.
+         * @since 1.2.0
+         */
+        struct pattern_entry {
+            signal<arguments...> channel;
+            int node;
+            unsigned int created;
+        };
+
+        int store(const char* text, unsigned int length) {
+            if (characters_used + length + 1 > CPP_CONNECTIONS_TOPIC_CHARACTERS) {
+                compact_characters();
+            }
+            if (characters_used + length + 1 > CPP_CONNECTIONS_TOPIC_CHARACTERS) {
+                return -1;
+            }
+
+            int offset = static_cast<int>(characters_used);
+            for (unsigned int i = 0; i < length; ++i) {
+                characters[characters_used++] = text[i];
+            }
+            characters[characters_used++] = '\0';
+            return offset;
+        }
+
+        /**
+         * @brief Returns the index of a pattern slot that holds no pattern, or -1.
+         * @since 1.2.0
+         */
+        int vacant_pattern() const {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_PATTERNS; ++i) {
+                if (patterns[i].node < 0) {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+        bool is_segment(const trie_node& node, char wildcard) const {
+            return node.length == 1 && characters[node.text] == wildcard;
+        }
+
+        /**
+         * @brief Finds the trie node of a pattern, optionally creating missing nodes.
+         * @since 1.2.0
+         *
+         * Nodes created for a pattern that turns out to be malformed or not to fit are pruned again.
+         *
+         * @return The node index, or -1 if it does not exist, the pattern has a `#`
+         *         segment that is not the last one, or trie storage is exhausted.
+         */
+        int find_node(const char* pattern, bool create) {
+            int node = 0;
+            const char* segment = pattern;
+
+            while (true) {
+                unsigned int length = 0;
+                while (segment[length] && segment[length] != '/') {
+                    length++;
+                }
+
+                if (is_segment(nodes[node], '#')) {
+                    if (create) {
+                        prune(node);
+                    }
+                    return -1;
+                }
+
+                int child = nodes[node].first_child;
+                int last = -1;
+                while (child >= 0 && !detail::strings_equal(characters + nodes[child].text, nodes[child].length, segment, length)) {
+                    last = child;
+                    child = nodes[child].next_sibling;
+                }
+
+                if (child < 0) {
+                    if (!create) {
+                        return -1;
+                    }
+                    if (vacant_nodes < 0 && nodes_used == CPP_CONNECTIONS_MAX_TRIE_NODES) {
+                        prune(node);
+                        return -1;
+                    }
+
+                    int text = store(segment, length);
+                    if (text < 0) {
+                        prune(node);
+                        return -1;
+                    }
+
+                    if (vacant_nodes >= 0) {
+                        child = vacant_nodes;
+                        vacant_nodes = nodes[child].next_sibling;
+                    } else {
+                        child = nodes_used++;
+                    }
+                    nodes[child].text = static_cast<unsigned int>(text);
+                    nodes[child].length = length;
+                    nodes[child].first_child = -1;
+                    nodes[child].next_sibling = -1;
+                    nodes[child].parent = node;
+                    nodes[child].pattern = -1;
+                    if (last >= 0) {
+                        nodes[last].next_sibling = child;
+                    } else {
+                        nodes[node].first_child = child;
+                    }
+                }
+
+                node = child;
+                if (!segment[length]) {
+                    return node;
+                }
+                segment += length + 1;
+            }
+        }
+
+        /**
+         * @brief Removes `node` and its ancestors from the trie for as long as they have neither a pattern nor children.
+         * @since 1.2.0
+         *
+         * Pruned nodes go to the vacant list; their characters are reclaimed by `compact_characters()`.
+         */
+        void prune(int node) {
+            while (node > 0 && nodes[node].pattern < 0 && nodes[node].first_child < 0) {
+                int parent = nodes[node].parent;
+                int* link = &nodes[parent].first_child;
+                while (*link != node) {
+                    link = &nodes[*link].next_sibling;
+                }
+                *link = nodes[node].next_sibling;
+
+                nodes[node].parent = -1;
+                nodes[node].next_sibling = vacant_nodes;
+                vacant_nodes = node;
+                node = parent;
+            }
+        }
+
+        /**
+         * @brief Moves the text of interned topics and trie nodes in use to the front of `characters`.
+         * @since 1.2.0
+         *
+         * Texts keep their relative order, so each is moved at most once. Takes time quadratic
+         * in the number of texts, which is acceptable since it only runs when storage is full.
+         */
+        void compact_characters() {
+            unsigned int kept = 0;
+            unsigned int from = 0;
+
+            while (true) {
+                unsigned int* lowest = nullptr;
+                unsigned int length = 0;
+                for (int i = 0; i < topics_used; ++i) {
+                    if (topics[i].text >= from && (!lowest || topics[i].text < *lowest)) {
+                        lowest = &topics[i].text;
+                        length = topics[i].length;
+                    }
+                }
+                for (int i = 1; i < nodes_used; ++i) {
+                    if (nodes[i].parent >= 0 && nodes[i].text >= from && (!lowest || nodes[i].text < *lowest)) {
+                        lowest = &nodes[i].text;
+                        length = nodes[i].length;
+                    }
+                }
+                if (!lowest) {
+                    break;
+                }
+
+                unsigned int offset = *lowest;
+                for (unsigned int i = 0; i <= length; ++i) {
+                    characters[kept + i] = characters[offset + i];
+                }
+                *lowest = kept;
+                kept += length + 1;
+                from = offset + length + 1;
+            }
+            characters_used = kept;
+        }
+
+        /**
+         * @brief Returns whether pattern slot `a` holds a pattern created after the one in slot `b`.
+         * @since 1.2.0
+         */
+        bool created_after(int a, int b) const {
+            return static_cast<int>(patterns[a].created - patterns[b].created) > 0;
+        }
+
+        void add_match(topic_entry& entry, int node) const {
+            int pattern = nodes[node].pattern;
+            if (pattern < 0) {
+                return;
+            }
+
+            unsigned int position = entry.match_count;
+            for (unsigned int i = 0; i < entry.match_count; ++i) {
+                if (entry.matches[i] == pattern) {
+                    return;
+                }
+            }
+            while (position > 0 && created_after(entry.matches[position - 1], pattern)) {
+                entry.matches[position] = entry.matches[position - 1];
+                position--;
+            }
+            entry.matches[position] = static_cast<unsigned char>(pattern);
+            entry.match_count++;
+        }
+
+        /**
+         * @brief Adds the patterns below `node` that match the topic remainder starting at `segment`.
+         * @since 1.2.0
+         *
+         * @param segment Start of the next topic segment, or nullptr once every segment was consumed.
+         */
+        void match(topic_entry& entry, int node, const char* segment) const {
+            unsigned int length = 0;
+            const char* rest = nullptr;
+            if (segment) {
+                while (segment[length] && segment[length] != '/') {
+                    length++;
+                }
+                rest = segment[length] ? segment + length + 1 : nullptr;
+            }
+
+            for (int child = nodes[node].first_child; child >= 0; child = nodes[child].next_sibling) {
+                if (is_segment(nodes[child], '#')) {
+                    add_match(entry, child);
+                    continue;
+                }
+                if (!segment) {
+                    continue;
+                }
+
+                if (is_segment(nodes[child], '*') || detail::strings_equal(characters + nodes[child].text, nodes[child].length, segment, length)) {
+                    if (rest) {
+                        match(entry, child, rest);
+                    } else {
+                        add_match(entry, child);
+                        match(entry, child, nullptr);
+                    }
+                }
+            }
+        }
+
+        void collect_matches(topic_entry& entry) {
+            entry.match_count = 0;
+            match(entry, 0, characters + entry.text);
+            entry.generation = generation;
+        }
+
+        /**
+         * @brief Releases every pattern without subscribers, deferring while a publish is running.
+         * @since 1.2.0
+         */
+        void release_empty_patterns() {
+            if (publishing > 0) {
+                release_pending = true;
+                return;
+            }
+
+            release_pending = false;
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_PATTERNS; ++i) {
+                if (patterns[i].node >= 0 && patterns[i].channel.connection_count() == 0) {
+                    int node = patterns[i].node;
+                    nodes[node].pattern = -1;
+                    patterns[i].node = -1;
+                    prune(node);
+                    generation++;
+                }
+            }
+        }
+
+        /**
+         * @brief Incremented whenever a pattern is added or released; topics cache against it.
+         * @since 1.2.0
+         */
+        unsigned int generation;
+
+        /**
+         * @brief Number of patterns created so far; stamps `pattern_entry::created` to order dispatch.
+         * @since 1.2.0
+         */
+        unsigned int patterns_created;
+
+        int topics_used;
+
+        /**
+         * @brief Number of trie nodes handed out at least once, the root included.
+         * @since 1.2.0
+         */
+        int nodes_used;
+
+        /**
+         * @brief First node of the list of pruned trie nodes, linked through `next_sibling`, or -1.
+         * @since 1.2.0
+         */
+        int vacant_nodes;
+        unsigned int characters_used;
+
+        /**
+         * @brief Nesting depth of `publish()`; pattern slots are not released while it is non-zero.
+         * @since 1.2.0
+         */
+        int publishing;
+
+        /**
+         * @brief Whether an unsubscribe happened during a publish and empty patterns await release.
+         * @since 1.2.0
+         */
+        bool release_pending;
+
+        /**
+         * @brief Open-addressing index from topic name hash to topic ID, or -1.
+         * @since 1.2.0
+         */
+        int topic_table[CPP_CONNECTIONS_MAX_TOPICS * 2];
+
+        topic_entry topics[CPP_CONNECTIONS_MAX_TOPICS];
+        trie_node nodes[CPP_CONNECTIONS_MAX_TRIE_NODES];
+        pattern_entry patterns[CPP_CONNECTIONS_MAX_PATTERNS];
+
+        /**
+         * @brief Null-terminated topic names and pattern segments.
+         * @since 1.2.0
+         */
+        char characters[CPP_CONNECTIONS_TOPIC_CHARACTERS];
+    };
+
+    namespace detail {
+        template<typename A, typename B>
+        struct is_same {
+            static const bool value = false;
+        };
+
+        template<typename T>
+        struct is_same<T, T> {
+            static const bool value = true;
+        };
+
+        /**
+         * @brief Converts between function pointer types through `void (*)()`.
+         * @since 1.2.0
+         *
+         * The result may only be called after converting it back to its original type.
+         * Going through the generic function pointer type keeps `-Wcast-function-type` quiet.
+         */
+        template<typename to_type, typename from_type>
+        to_type function_cast(from_type function) {
+            return reinterpret_cast<to_type>(reinterpret_cast<void (*)()>(function));
+        }
+
+        template<typename T, typename... types>
+        struct contains {
+            static const bool value = false;
+        };
+
+        template<typename T, typename first, typename... rest>
+        struct contains<T, first, rest...> {
+            static const bool value = contains<T, rest...>::value;
+        };
+
+        template<typename T, typename... rest>
+        struct contains<T, T, rest...> {
+            static const bool value = true;
+        };
+
+        /**
+         * @brief Base class of `event_bus` holding the signal of one event type.
+         * @since 1.2.0
+         */
+        template<typename event_type>
+        struct event_channel {
+            signal<const event_type&> channel;
+        };
+    }
+
+    /**
+     * @brief Type-indexed event bus with one `signal<const Event&>` per registered event type.
+     * @since 1.2.0
+     *
+     * The bus derives from one channel per event type in `events`, so selecting the signal
+     * for an event is a base-class conversion resolved entirely at compile time.
+     * `publish(event)` compiles down to a direct `fire()` on that event type's signal,
+     * with no runtime lookup, hashing or type identification.
+     *
+     * Publishing or subscribing to a type that is not in `events` is a compile error,
+     * and so is listing the same event type twice.
+     *
+     * @tparam events The event types this bus can carry.
+     */
+    template<typename... events>
+    class event_bus : private detail::event_channel<events>... {
+    public:
+        /**
+         * @brief Returns the signal carrying events of the given type.
+         * @since 1.2.0
+         *
+         * Gives access to the full signal interface, e.g. to suspend or forward one event type.
+         *
+         * @tparam event_type One of the bus's event types.
+         * @return Reference to the signal for `event_type`.
+         */
+        template<typename event_type>
+        signal<const event_type&>& channel() {
+            static_assert(detail::contains<event_type, events...>::value, "event type is not registered with this event_bus");
+            return static_cast<detail::event_channel<event_type>&>(*this).channel;
+        }
+
+        template<typename event_type>
+        const signal<const event_type&>& channel() const {
+            static_assert(detail::contains<event_type, events...>::value, "event type is not registered with this event_bus");
+            return static_cast<const detail::event_channel<event_type>&>(*this).channel;
+        }
+
+        /**
+         * @brief Registers a persistent callback for one event type.
+         * @since 1.2.0
+         *
+         * The event type is deduced from the callback's signature.
+         *
+         * @param function Pointer to the callback function to invoke when the event is published.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if the event type's signal is full.
+         */
+        template<typename event_type>
+        connection<const event_type&>* subscribe(void (*function)(void* context, const event_type&), void* context) {
+            return channel<event_type>().connect(function, context);
+        }
+
+        /**
+         * @brief Registers a one-shot callback for one event type.
+         * @since 1.2.0
+         *
+         * @param function Pointer to the callback function to invoke the next time the event is published.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if the event type's signal is full.
+         */
+        template<typename event_type>
+        connection<const event_type&>* subscribe_once(void (*function)(void* context, const event_type&), void* context) {
+            return channel<event_type>().once(function, context);
+        }
+
+        /**
+         * @brief Publishes an event to the subscribers of its type.
+         * @since 1.2.0
+         *
+         * @param event The event to deliver; subscribers receive it by const reference.
+         */
+        template<typename event_type>
+        void publish(const event_type& event) {
+            channel<event_type>().fire(event);
+        }
+
+        /**
+         * @brief Disconnects every subscriber with the given context from all event types.
+         * @since 1.2.0
+         *
+         * @param context The user-defined context pointer to match and disconnect.
+         */
+        void disconnect_by_context(void* context) {
+            int expand[] = { 0, (static_cast<detail::event_channel<events>&>(*this).channel.disconnect_by_context(context), 0)... };
+            (void)expand;
+        }
+
+        /**
+         * @brief Disconnects every subscriber from all event types.
+         * @since 1.2.0
+         */
+        void disconnect_all() {
+            int expand[] = { 0, (static_cast<detail::event_channel<events>&>(*this).channel.disconnect_all(), 0)... };
+            (void)expand;
+        }
+    };
+
+    /**
+     * @brief A signal whose subscribers each listen to an inclusive range of values.
+     * @since 1.2.0
+     *
+     * Subscribers connect with an interval `[low, high]`, and `fire(value, args...)` only
+     * invokes the subscribers whose interval contains `value`. Intervals are kept in an
+     * index sorted by their lower bound, over which an implicit binary tree records the
+     * interval with the largest upper bound below every node (an augmented interval tree).
+     * A fire binary-searches the last interval starting at or below `value`, then descends
+     * the tree within that prefix and prunes every subtree whose largest upper bound is
+     * below `value`. Dispatching to `k` of `n` subscribers therefore costs O((k + 1) log n)
+     * comparisons instead of one per interval.
+     *
+     * Connecting inserts into the sorted index in place, and disconnected intervals are
+     * compacted out after the next fire. Connections made by callbacks during a fire are
+     * merged into the index once the outermost fire returns. Subscribers whose intervals
+     * contain the fired value run in ascending order of lower bound, then connection order.
+     *
+     * @tparam value_type The ordered value type; it must support `<` and copy assignment.
+     * @tparam arguments The remaining argument types forwarded to each callback upon firing.
+     */
+    template<typename value_type, typename... arguments>
+    class range_signal {
+    public:
+        /**
+         * @brief Constructs an active range signal with no subscribers.
+         * @since 1.2.0
+         */
+        range_signal() : active(true), dirty(false), firing(0), count(0), waiting_count(0) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                nodes[i].connected = false;
+                nodes[i].owner = nullptr;
+                nodes[i].links = nullptr;
+                state[i] = node_free;
+            }
+            refresh_tree(0);
+        }
+
+        /**
+         * @brief Disconnects every subscriber before the signal is destroyed.
+         * @since 1.2.0
+         */
+        ~range_signal() {
+            disconnect_all();
+        }
+
+        range_signal(const range_signal&) = delete;
+        range_signal& operator=(const range_signal&) = delete;
+
+        /**
+         * @brief Registers a persistent callback for every value in `[low, high]`.
+         * @since 1.2.0
+         *
+         * @param low Smallest value the callback is interested in.
+         * @param high Largest value the callback is interested in.
+         * @param function Pointer to the callback function to invoke for matching values.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if full or `high < low`.
+         */
+        connection<value_type, arguments...>* connect(value_type low, value_type high, void (*function)(void* context, value_type, arguments...), void* context) {
+            return attach(low, high, function, context, false);
+        }
+
+        /**
+         * @brief Registers a one-shot callback for the next fired value in `[low, high]`.
+         * @since 1.2.0
+         *
+         * @param low Smallest value the callback is interested in.
+         * @param high Largest value the callback is interested in.
+         * @param function Pointer to the callback function to invoke once for a matching value.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if full or `high < low`.
+         */
+        connection<value_type, arguments...>* once(value_type low, value_type high, void (*function)(void* context, value_type, arguments...), void* context) {
+            return attach(low, high, function, context, true);
+        }
+
+        /**
+         * @brief Disconnects every subscriber.
+         * @since 1.2.0
+         */
+        void disconnect_all() {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                nodes[i].disconnect();
+            }
+            settle();
+        }
+
+        /**
+         * @brief Disconnects every subscriber whose callback matches the given pointer.
+         * @since 1.2.0
+         *
+         * @param callback The callback function pointer to match and disconnect.
+         */
+        void disconnect_by_callback(void (*callback)(void*, value_type, arguments...)) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                if (nodes[i].connected && nodes[i].callback == callback) {
+                    nodes[i].disconnect();
+                }
+            }
+            settle();
+        }
+
+        /**
+         * @brief Disconnects every subscriber whose context matches the given pointer.
+         * @since 1.2.0
+         *
+         * @param context The user-defined context pointer to match and disconnect.
+         */
+        void disconnect_by_context(void* context) {
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                if (nodes[i].connected && nodes[i].context == context) {
+                    nodes[i].disconnect();
+                }
+            }
+            settle();
+        }
+
+        /**
+         * @brief Suspends the signal, preventing any callbacks from being invoked during `fire()`.
+         * @since 1.2.0
+         */
+        void suspend() {
+            active = false;
+        }
+
+        /**
+         * @brief Resumes the signal, allowing callbacks to be invoked normally during `fire()`.
+         * @since 1.2.0
+         */
+        void resume() {
+            active = true;
+        }
+
+        /**
+         * @brief Fires the signal for one value, invoking only subscribers whose interval contains it.
+         * @since 1.2.0
+         *
+         * @param value The value to dispatch.
+         * @param args The argument pack forwarded to each callback function.
+         */
+        void fire(value_type value, arguments... args) {
+            if (!active) {
+                return;
+            }
+
+            firing++;
+
+            struct span {
+                int node;
+                int first;
+                int width;
+            };
+
+            int end = upper_bound(value);
+            span pending[2 * tree_levels + 2];
+            int depth = 0;
+            if (end > 0) {
+                pending[depth++] = span { 1, 0, tree_leaves };
+            }
+
+            while (depth > 0) {
+                span top = pending[--depth];
+                int widest = widest_below[top.node];
+                if (top.first >= end || widest < 0 || highs[widest] < value) {
+                    continue;
+                }
+
+                if (top.width > 1) {
+                    int half = top.width / 2;
+                    pending[depth++] = span { 2 * top.node + 1, top.first + half, half };
+                    pending[depth++] = span { 2 * top.node, top.first, half };
+                    continue;
+                }
+
+                connection<value_type, arguments...>& current = nodes[index[top.first]];
+                if (current.connected && current.callback && !current.muted()) {
+                    current.callback(current.context, value, args...);
+
+                    if (current.once) {
+                        current.disconnect();
+                    }
+                }
+                if (!current.connected) {
+                    dirty = true;
+                }
+            }
+
+            firing--;
+            settle();
+        }
+
+        /**
+         * @brief Returns the number of connected subscribers.
+         * @since 1.2.0
+         */
+        unsigned int connection_count() const {
+            unsigned int connected = 0;
+
+            for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                if (nodes[i].connected) {
+                    connected++;
+                }
+            }
+            return connected;
+        }
+
+        /**
+         * @brief Returns the compile-time maximum number of connections this signal can manage.
+         * @since 1.2.0
+         */
+        int max_connections() const {
+            return CPP_CONNECTIONS_MAX_CONNECTIONS;
+        }
+
+    private:
+        /**
+         * @brief Returns the smallest power of two that is at least `count`.
+         * @since 1.2.0
+         */
+        static constexpr int round_up(int count, int power = 1) {
+            return power >= count ? power : round_up(count, power * 2);
+        }
+
+        /**
+         * @brief Returns the base-2 logarithm of a power of two.
+         * @since 1.2.0
+         */
+        static constexpr int log2(int power) {
+            return power <= 1 ? 0 : 1 + log2(power / 2);
+        }
+
+        /**
+         * @brief Number of leaves of the interval tree, one per sorted index entry.
+         * @since 1.2.0
+         */
+        static const int tree_leaves = round_up(CPP_CONNECTIONS_MAX_CONNECTIONS);
+
+        /**
+         * @brief Height of the interval tree.
+         * @since 1.2.0
+         */
+        static const int tree_levels = log2(tree_leaves);
+
+        static const unsigned char node_free = 0;
+        static const unsigned char node_indexed = 1;
+        static const unsigned char node_waiting = 2;
+
+        connection<value_type, arguments...>* attach(value_type low, value_type high, void (*function)(void*, value_type, arguments...), void* context, bool once) {
+            if (high < low) {
+                return nullptr;
+            }
+
+            int node = allocate_node();
+            if (node < 0) {
+                return nullptr;
+            }
+
+            nodes[node].connected = true;
+            nodes[node].once = once;
+            nodes[node].callback = function;
+            nodes[node].context = context;
+            nodes[node].links = nullptr;
+            node_low[node] = low;
+            node_high[node] = high;
+
+            if (firing > 0) {
+                state[node] = node_waiting;
+                waiting[waiting_count++] = node;
+            } else {
+                insert(node);
+            }
+            return &nodes[node];
+        }
+
+        int allocate_node() {
+            for (int pass = 0; pass < 2; ++pass) {
+                for (int i = 0; i < CPP_CONNECTIONS_MAX_CONNECTIONS; ++i) {
+                    if (state[i] == node_free) {
+                        return i;
+                    }
+                }
+                if (firing > 0) {
+                    break;
+                }
+                dirty = true;
+                settle();
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Returns the first sorted position whose lower bound is greater than `value`.
+         * @since 1.2.0
+         */
+        int upper_bound(const value_type& value) const {
+            int first = 0;
+            int last = count;
+
+            while (first < last) {
+                int middle = first + (last - first) / 2;
+                if (value < lows[middle]) {
+                    last = middle;
+                } else {
+                    first = middle + 1;
+                }
+            }
+            return first;
+        }
+
+        /**
+         * @brief Inserts a node into the sorted index after all intervals with the same lower bound.
+         * @since 1.2.0
+         */
+        void insert(int node) {
+            int position = upper_bound(node_low[node]);
+
+            for (int i = count; i > position; --i) {
+                index[i] = index[i - 1];
+                lows[i] = lows[i - 1];
+                highs[i] = highs[i - 1];
+            }
+            index[position] = node;
+            lows[position] = node_low[node];
+            highs[position] = node_high[node];
+            state[node] = node_indexed;
+            count++;
+
+            refresh_tree(position);
+        }
+
+        /**
+         * @brief Rebuilds the interval tree above the sorted entries from `first` on.
+         * @since 1.2.0
+         *
+         * Inserting or compacting shifts every entry behind the changed position anyway,
+         * so the affected leaves and all their ancestors are recomputed bottom-up.
+         *
+         * @param first The first sorted position whose entry changed.
+         */
+        void refresh_tree(int first) {
+            for (int position = first; position < tree_leaves; ++position) {
+                widest_below[tree_leaves + position] = position < count ? position : -1;
+            }
+
+            for (int low = (tree_leaves + first) / 2, high = (2 * tree_leaves - 1) / 2; low >= 1; low /= 2, high /= 2) {
+                for (int node = low; node <= high; ++node) {
+                    int left = widest_below[2 * node];
+                    int right = widest_below[2 * node + 1];
+                    widest_below[node] = right < 0 || (left >= 0 && !(highs[left] < highs[right])) ? left : right;
+                }
+            }
+        }
+
+        /**
+         * @brief Compacts disconnected intervals out of the index and merges waiting ones in.
+         * @since 1.2.0
+         *
+         * Does nothing while a fire is running; the outermost fire calls it again on return.
+         */
+        void settle() {
+            if (firing > 0) {
+                return;
+            }
+
+            if (dirty) {
+                dirty = false;
+                int kept = 0;
+                for (int position = 0; position < count; ++position) {
+                    int node = index[position];
+                    if (!nodes[node].connected) {
+                        state[node] = node_free;
+                        continue;
+                    }
+                    index[kept] = node;
+                    lows[kept] = lows[position];
+                    highs[kept] = highs[position];
+                    kept++;
+                }
+                if (kept != count) {
+                    count = kept;
+                    refresh_tree(0);
+                }
+            }
+
+            for (int i = 0; i < waiting_count; ++i) {
+                int node = waiting[i];
+                if (nodes[node].connected) {
+                    insert(node);
+                } else {
+                    state[node] = node_free;
+                }
+            }
+            waiting_count = 0;
+        }
+
+        /**
+         * @brief Whether `fire()` currently dispatches callbacks.
+         * @since 1.2.0
+         */
+        bool active;
+
+        /**
+         * @brief Whether the sorted index may contain disconnected intervals.
+         * @since 1.2.0
+         */
+        bool dirty;
+
+        /**
+         * @brief Nesting depth of `fire()`; the index is not restructured while it is non-zero.
+         * @since 1.2.0
+         */
+        int firing;
+
+        /**
+         * @brief Number of entries in the sorted index.
+         * @since 1.2.0
+         */
+        int count;
+
+        /**
+         * @brief Number of nodes connected during a fire and waiting to be indexed.
+         * @since 1.2.0
+         */
+        int waiting_count;
+
+        /**
+         * @brief Node indices sorted by lower bound, with matching `lows` and `highs`.
+         * @since 1.2.0
+         */
+        int index[CPP_CONNECTIONS_MAX_CONNECTIONS];
+        value_type lows[CPP_CONNECTIONS_MAX_CONNECTIONS];
+        value_type highs[CPP_CONNECTIONS_MAX_CONNECTIONS];
+
+        /**
+         * @brief Implicit interval tree over the sorted index, stored as a binary heap.
+         * @since 1.2.0
+         *
+         * Node 1 is the root and the children of node `i` are `2 * i` and `2 * i + 1`; leaf
+         * `tree_leaves + p` stands for sorted position `p`. Each node holds the sorted position
+         * with the largest upper bound among its leaves, or -1 if none of them is in use.
+         */
+        int widest_below[2 * tree_leaves];
+
+        /**
+         * @brief Connection storage; entries are stable while connected.
+         * @since 1.2.0
+         */
+        connection<value_type, arguments...> nodes[CPP_CONNECTIONS_MAX_CONNECTIONS];
+        value_type node_low[CPP_CONNECTIONS_MAX_CONNECTIONS];
+        value_type node_high[CPP_CONNECTIONS_MAX_CONNECTIONS];
+        unsigned char state[CPP_CONNECTIONS_MAX_CONNECTIONS];
+        int waiting[CPP_CONNECTIONS_MAX_CONNECTIONS];
+    };
+
+    /**
+     * @brief Ready-made result combiners for `collecting_signal`.
+     * @since 1.2.0
+     *
+     * A combiner is any object callable as `bool(const result_type&)`. It is handed each
+     * subscriber's return value in dispatch order and returns `false` once the outcome is
+     * decided, which stops the dispatch so the remaining subscribers do not run.
+     */
+    namespace combiners {
+        /**
+         * @brief Keeps the first result and stops dispatch immediately after it.
+         * @since 1.2.0
+         */
+        template<typename T>
+        struct first {
+            T value;
+            bool found;
+
+            first() : value(), found(false) {}
+
+            bool operator()(const T& result) {
+                value = result;
+                found = true;
+                return false;
+            }
+        };
+
+        /**
+         * @brief Keeps the result of the last subscriber.
+         * @since 1.2.0
+         */
+        template<typename T>
+        struct last {
+            T value;
+            bool found;
+
+            last() : value(), found(false) {}
+
+            bool operator()(const T& result) {
+                value = result;
+                found = true;
+                return true;
+            }
+        };
+
+        /**
+         * @brief Adds up every result, starting from an initial value.
+         * @since 1.2.0
+         */
+        template<typename T>
+        struct sum {
+            T value;
+
+            explicit sum(const T& initial = T()) : value(initial) {}
+
+            bool operator()(const T& result) {
+                value = value + result;
+                return true;
+            }
+        };
+
+        /**
+         * @brief Keeps the smallest result according to `<`.
+         * @since 1.2.0
+         */
+        template<typename T>
+        struct minimum {
+            T value;
+            bool found;
+
+            minimum() : value(), found(false) {}
+
+            bool operator()(const T& result) {
+                if (!found || result < value) {
+                    value = result;
+                    found = true;
+                }
+                return true;
+            }
+        };
+
+        /**
+         * @brief Keeps the largest result according to `<`.
+         * @since 1.2.0
+         */
+        template<typename T>
+        struct maximum {
+            T value;
+            bool found;
+
+            maximum() : value(), found(false) {}
+
+            bool operator()(const T& result) {
+                if (!found || value < result) {
+                    value = result;
+                    found = true;
+                }
+                return true;
+            }
+        };
+
+        /**
+         * @brief `true` unless a subscriber returns `false`, which stops dispatch.
+         * @since 1.2.0
+         *
+         * Suited to validation hooks: any subscriber can veto and the rest are skipped.
+         */
+        struct all_of {
+            bool value;
+
+            all_of() : value(true) {}
+
+            bool operator()(bool result) {
+                value = result;
+                return result;
+            }
+        };
+
+        /**
+         * @brief `false` unless a subscriber returns `true`, which stops dispatch.
+         * @since 1.2.0
+         */
+        struct any_of {
+            bool value;
+
+            any_of() : value(false) {}
+
+            bool operator()(bool result) {
+                value = result;
+                return !result;
+            }
+        };
+
+        /**
+         * @brief Copies every result into a caller-provided buffer.
+         * @since 1.2.0
+         *
+         * Dispatch always runs to completion. `total` counts every result, while only
+         * the first `capacity` of them are written to the buffer (`size()` of them).
+         */
+        template<typename T>
+        struct collect {
+            T* buffer;
+            unsigned int capacity;
+            unsigned int total;
+
+            collect(T* storage, unsigned int slots) : buffer(storage), capacity(slots), total(0) {}
+
+            bool operator()(const T& result) {
+                if (total < capacity) {
+                    buffer[total] = result;
+                }
+                total++;
+                return true;
+            }
+
+            unsigned int size() const {
+                return total < capacity ? total : capacity;
+            }
+        };
+    }
+
+    /**
+     * @brief A signal whose callbacks return a value that is folded together by a combiner.
+     * @since 1.2.0
+     *
+     * Callbacks have the signature `result_type(void* context, arguments...)`. `fire()` takes
+     * a combiner (see `combiners`) that receives each result in dispatch order and can stop
+     * the dispatch early once the outcome is decided, e.g. on the first veto of `all_of`.
+     * Results are therefore aggregated without side-channel context objects.
+     *
+     * Connections are stored in an internal `signal<arguments...>`, so ordering, one-shot
+     * semantics and capacity match a plain signal.
+     *
+     * @note The returned connection handles store the callback type-erased as
+     *       `void (*)(void*, arguments...)`. They can be disconnected, scoped and inspected,
+     *       but their `callback` must not be called directly.
+     *
+     * @tparam result_type The return type of the callbacks; use `signal` for `void`.
+     * @tparam arguments The argument types forwarded to each callback upon firing.
+     */
+    template<typename result_type, typename... arguments>
+    class collecting_signal {
+        static_assert(!detail::is_same<result_type, void>::value, "use signal for callbacks returning void");
+
+    public:
+        /**
+         * @brief Registers a persistent result-returning callback.
+         * @since 1.2.0
+         *
+         * @param function Pointer to the callback function to invoke on signal firing.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection if successful, nullptr if full.
+         */
+        connection<arguments...>* connect(result_type (*function)(void* context, arguments...), void* context) {
+            return slots.connect(detail::function_cast<void (*)(void*, arguments...)>(function), context);
+        }
+
+        /**
+         * @brief Registers a one-shot result-returning callback.
+         * @since 1.2.0
+         *
+         * A one-shot callback skipped because a combiner stopped the dispatch stays connected.
+         *
+         * @param function Pointer to the callback function to invoke on signal firing.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection if successful, nullptr if full.
+         */
+        connection<arguments...>* once(result_type (*function)(void* context, arguments...), void* context) {
+            return slots.once(detail::function_cast<void (*)(void*, arguments...)>(function), context);
+        }
+
+        /**
+         * @brief Disconnects all currently active connections.
+         * @since 1.2.0
+         */
+        void disconnect_all() {
+            slots.disconnect_all();
+        }
+
+        /**
+         * @brief Disconnects all connections whose callback matches the given pointer.
+         * @since 1.2.0
+         *
+         * @param callback The callback function pointer to match and disconnect.
+         */
+        void disconnect_by_callback(result_type (*callback)(void*, arguments...)) {
+            slots.disconnect_by_callback(detail::function_cast<void (*)(void*, arguments...)>(callback));
+        }
+
+        /**
+         * @brief Disconnects all connections whose context matches the given pointer.
+         * @since 1.2.0
+         *
+         * @param context The user-defined context pointer to match and disconnect.
+         */
+        void disconnect_by_context(void* context) {
+            slots.disconnect_by_context(context);
+        }
+
+        /**
+         * @brief Suspends the signal, preventing any callbacks from being invoked during `fire()`.
+         * @since 1.2.0
+         */
+        void suspend() {
+            slots.suspend();
+        }
+
+        /**
+         * @brief Resumes the signal, allowing callbacks to be invoked normally during `fire()`.
+         * @since 1.2.0
+         */
+        void resume() {
+            slots.resume();
+        }
+
+        /**
+         * @brief Fires the signal and feeds every callback's result to the combiner.
+         * @since 1.2.0
+         *
+         * Dispatch stops as soon as the combiner returns `false`. While suspended, no
+         * callback runs and the combiner is left untouched.
+         *
+         * @param combiner Object callable as `bool(const result_type&)`, e.g. from `combiners`.
+         * @param args The argument pack forwarded to each callback function.
+         * @return `false` if the combiner stopped the dispatch early, `true` otherwise.
+         */
+        template<typename combiner_type>
+        bool fire(combiner_type& combiner, arguments... args) {
+            if (!slots.active) {
+                return true;
+            }
+
+            auto invoke = [&](connection<arguments...>& current) -> bool {
+                result_type (*function)(void*, arguments...) = detail::function_cast<result_type (*)(void*, arguments...)>(current.callback);
+                return combiner(function(current.context, args...));
+            };
+            return slots.visit(invoke);
+        }
+
+        /**
+         * @brief Returns the compile-time maximum number of connections this signal can manage.
+         * @since 1.2.0
+         */
+        int max_connections() const {
+            return slots.max_connections();
+        }
+
+        /**
+         * @brief Returns the current number of active connections.
+         * @since 1.2.0
+         */
+        unsigned int connection_count() const {
+            return slots.connection_count();
+        }
+
+    private:
+        /**
+         * @brief Connection storage holding the type-erased callbacks.
+         * @since 1.2.0
+         */
+        signal<arguments...> slots;
+    };
+
+    /**
+     * @brief Memory source for the slabs of a `signal_pool`.
+     * @since 1.2.0
+     *
+     * The default allocator uses the global `operator new` and `operator delete`. Supplying
+     * functions that map huge pages (for example `mmap` with `MAP_HUGETLB` on Linux) backs
+     * the pool with huge pages; `signal_pool::slab_bytes()` tells how large each request is,
+     * and `CPP_CONNECTIONS_POOL_SLAB_SIGNALS` can be tuned so it fills whole pages.
+     */
+    struct arena_allocator {
+        /**
+         * @brief Returns `bytes` bytes of memory suitably aligned for any object, or nullptr.
+         * @since 1.2.0
+         */
+        void* (*allocate)(detail::size_type bytes, void* user);
+
+        /**
+         * @brief Returns memory obtained from `allocate` with the same size.
+         * @since 1.2.0
+         */
+        void (*release)(void* memory, detail::size_type bytes, void* user);
+
+        /**
+         * @brief User-defined pointer passed to both functions.
+         * @since 1.2.0
+         */
+        void* user;
+    };
+
+    namespace detail {
+        inline void* allocate_global(size_type bytes, void*) {
+            return ::operator new(bytes);
+        }
+
+        inline void release_global(void* memory, size_type, void*) {
+            ::operator delete(memory);
+        }
+    }
+
+    /**
+     * @brief Returns the allocator backed by the global `operator new` and `operator delete`.
+     * @since 1.2.0
+     */
+    inline arena_allocator default_allocator() {
+        arena_allocator allocator = { &detail::allocate_global, &detail::release_global, nullptr };
+        return allocator;
+    }
+}
+
+inline void* operator new(connections::detail::size_type, connections::detail::placement_tag, void* where) noexcept {
+    return where;
+}
+
+inline void operator delete(void*, connections::detail::placement_tag, void*) noexcept {}
+
+namespace connections {
+    /**
+     * @brief Allocates signals in bulk from slab arenas instead of one allocation per signal.
+     * @since 1.2.0
+     *
+     * Signals are carved out of slabs holding `CPP_CONNECTIONS_POOL_SLAB_SIGNALS` signals each,
+     * including their inline connection storage, which keeps per-entity signals close together
+     * in memory and avoids fragmentation. Constructing a signal touches none of its connection
+     * slots, so creating a signal costs a handful of stores and destroying one without
+     * connections costs about the same. Destroyed signals are recycled through a free list.
+     *
+     * `clear()` destroys every signal still alive and hands all slabs back to the allocator
+     * at once, for example when a level is unloaded.
+     *
+     * The pool speeds up creation and destruction; it does not make signals smaller. Every
+     * signal reserves its full connection storage inline: `CPP_CONNECTIONS_MAX_CONNECTIONS`
+     * slots of roughly 85 bytes each, counting the packed dispatch arrays, plus a ring of
+     * `CPP_CONNECTIONS_MAX_ONE_SHOTS` one-shot connections, which comes to about 12 KB per
+     * `signal<int>` with the default limits, or about 12 GB for a million of them. Slab memory
+     * is only committed as far as it is touched, but a pool of that many full-sized signals is
+     * not practical. Either lower both limits to what an entity really needs, or give each
+     * event kind one `signal_array`, which stores every entity's subscribers in shared storage
+     * sized by the connections actually made and costs a few bytes per entity.
+     *
+     * @tparam arguments The argument types of the pooled signals.
+     */
+    template<typename... arguments>
+    class signal_pool {
+    public:
+        /**
+         * @brief Constructs an empty pool that allocates slabs with `default_allocator()`.
+         * @since 1.2.0
+         */
+        signal_pool() : allocator(default_allocator()), slabs(nullptr), free_cells(nullptr), live(0), cell_count(0) {}
+
+        /**
+         * @brief Constructs an empty pool that allocates slabs with the given allocator.
+         * @since 1.2.0
+         *
+         * @param source The allocator providing slab memory, for example one backed by huge pages.
+         */
+        explicit signal_pool(const arena_allocator& source) : allocator(source), slabs(nullptr), free_cells(nullptr), live(0), cell_count(0) {}
+
+        signal_pool(const signal_pool&) = delete;
+        signal_pool& operator=(const signal_pool&) = delete;
+
+        /**
+         * @brief Destroys every remaining signal and releases all slabs.
+         * @since 1.2.0
+         */
+        ~signal_pool() {
+            clear();
+        }
+
+        /**
+         * @brief Creates a signal in the pool.
+         * @since 1.2.0
+         *
+         * Recycles the most recently destroyed signal's storage if there is one,
+         * and otherwise takes the next unused cell, allocating a new slab if needed.
+         *
+         * @return Pointer to the new signal, or nullptr if the allocator returned no memory.
+         */
+        signal<arguments...>* create() {
+            cell* target = free_cells;
+            if (target) {
+                free_cells = target->next_free;
+            } else {
+                if (!slabs || slabs->used == CPP_CONNECTIONS_POOL_SLAB_SIGNALS) {
+                    slab* added = static_cast<slab*>(allocator.allocate(sizeof(slab), allocator.user));
+                    if (!added) {
+                        return nullptr;
+                    }
+
+                    added->next = slabs;
+                    added->used = 0;
+                    for (unsigned int i = 0; i < slab_words; ++i) {
+                        added->alive[i] = 0;
+                    }
+                    slabs = added;
+                    cell_count += CPP_CONNECTIONS_POOL_SLAB_SIGNALS;
+                }
+
+                target = &slabs->cells[slabs->used++];
+                target->home = slabs;
+            }
+
+            unsigned int index = static_cast<unsigned int>(target - target->home->cells);
+            target->home->alive[index / 32] |= 1u << (index % 32);
+            live++;
+            return new (detail::placement_tag(), target->storage) signal<arguments...>();
+        }
+
+        /**
+         * @brief Creates several signals at once.
+         * @since 1.2.0
+         *
+         * @param signals Array receiving up to `count` pointers to new signals.
+         * @param count Number of signals to create.
+         * @return Number of signals created, which is less than `count` only if the allocator ran out of memory.
+         */
+        unsigned int create(signal<arguments...>** signals, unsigned int count) {
+            for (unsigned int i = 0; i < count; ++i) {
+                signals[i] = create();
+                if (!signals[i]) {
+                    return i;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Destroys a signal created by this pool and recycles its storage.
+         * @since 1.2.0
+         *
+         * The signal's destructor runs first, disconnecting all of its connections.
+         *
+         * @param target The signal to destroy; nullptr is ignored.
+         */
+        void destroy(signal<arguments...>* target) {
+            if (!target) {
+                return;
+            }
+
+            cell* freed = reinterpret_cast<cell*>(target);
+            target->~signal();
+
+            unsigned int index = static_cast<unsigned int>(freed - freed->home->cells);
+            freed->home->alive[index / 32] &= ~(1u << (index % 32));
+            freed->next_free = free_cells;
+            free_cells = freed;
+            live--;
+        }
+
+        /**
+         * @brief Destroys several signals created by this pool.
+         * @since 1.2.0
+         *
+         * @param signals Array of `count` signals to destroy; nullptr entries are ignored.
+         * @param count Number of entries in `signals`.
+         */
+        void destroy(signal<arguments...>* const* signals, unsigned int count) {
+            for (unsigned int i = 0; i < count; ++i) {
+                destroy(signals[i]);
+            }
+        }
+
+        /**
+         * @brief Destroys every signal still alive and returns all slabs to the allocator.
+         * @since 1.2.0
+         *
+         * Slabs are walked through their liveness bitmaps word by word, so the cost
+         * is proportional to the number of slabs plus the number of live signals.
+         * Pointers to signals of this pool are invalid afterwards.
+         */
+        void clear() {
+            while (slabs) {
+                slab* current = slabs;
+                slabs = current->next;
+
+                for (unsigned int word = 0; word < slab_words; ++word) {
+                    unsigned int bits = current->alive[word];
+                    for (unsigned int bit = 0; bits != 0; ++bit, bits >>= 1) {
+                        if (bits & 1u) {
+                            reinterpret_cast<signal<arguments...>*>(current->cells[word * 32 + bit].storage)->~signal();
+                        }
+                    }
+                }
+
+                allocator.release(current, sizeof(slab), allocator.user);
+            }
+
+            free_cells = nullptr;
+            live = 0;
+            cell_count = 0;
+        }
+
+        /**
+         * @brief Returns the number of signals currently alive in the pool.
+         * @since 1.2.0
+         */
+        unsigned int size() const {
+            return live;
+        }
+
+        /**
+         * @brief Returns the number of signals the allocated slabs can hold.
+         * @since 1.2.0
+         */
+        unsigned int capacity() const {
+            return cell_count;
+        }
+
+        /**
+         * @brief Returns the size of each slab requested from the allocator.
+         * @since 1.2.0
+         */
+        static detail::size_type slab_bytes() {
+            return sizeof(slab);
+        }
+
+    private:
+        struct slab;
+
+        /**
+         * @brief Storage for one pooled signal.
+         * @since 1.2.0
+         *
+         * The signal is placed at the start of the cell, so a signal pointer
+         * converts back to its cell without any lookup.
+         */
+        struct cell {
+            alignas(signal<arguments...>) unsigned char storage[sizeof(signal<arguments...>)];
+            slab* home;
+            cell* next_free;
+        };
+
+        /**
+         * @brief Number of 32-bit words in the liveness bitmap of each slab.
+         * @since 1.2.0
+         */
+        static const unsigned int slab_words = (CPP_CONNECTIONS_POOL_SLAB_SIGNALS + 31) / 32;
+
+        /**
+         * @brief One block of memory obtained from the allocator.
+         * @since 1.2.0
+         */
+        struct slab {
+            slab* next;
+            unsigned int used;
+            unsigned int alive[slab_words];
+            cell cells[CPP_CONNECTIONS_POOL_SLAB_SIGNALS];
+        };
+
+        /**
+         * @brief Source of slab memory.
+         * @since 1.2.0
+         */
+        arena_allocator allocator;
+
+        /**
+         * @brief Singly linked list of slabs, most recently allocated first.
+         * @since 1.2.0
+         *
+         * Only the first slab can have unused cells; older ones are full or recycled through `free_cells`.
+         */
+        slab* slabs;
+
+        /**
+         * @brief Stack of cells whose signal was destroyed.
+         * @since 1.2.0
+         */
+        cell* free_cells;
+
+        /**
+         * @brief Number of signals currently alive.
+         * @since 1.2.0
+         */
+        unsigned int live;
+
+        /**
+         * @brief Number of cells in all allocated slabs.
+         * @since 1.2.0
+         */
+        unsigned int cell_count;
+    };
+
+    namespace detail {
+        /**
+         * @brief Reserves room for `count` objects of type `T` in a block being laid out.
+         * @since 1.2.0
+         *
+         * @param bytes Size of the block so far, advanced past the reserved room.
+         * @param count Number of objects to reserve room for.
+         * @return Offset of the reserved room from the start of the block, aligned for `T`.
+         */
+        template<typename T>
+        size_type reserve(size_type& bytes, size_type count) {
+            size_type offset = (bytes + alignof(T) - 1) / alignof(T) * alignof(T);
+            bytes = offset + sizeof(T) * count;
+            return offset;
+        }
+    }
+
+    /**
+     * @brief A fixed number of logical signals, one per entity, sharing packed connection storage.
+     * @since 1.2.0
+     *
+     * Intended for entity-component style code, where every entity would otherwise own
+     * its own `signal`. All connections live in shared structure-of-arrays storage sorted
+     * by entity index, so `fire(entity, args...)` walks one contiguous range and
+     * `fire_all(args...)` broadcasts to every entity in a single linear pass instead of
+     * visiting N separate signals scattered across memory.
+     *
+     * Callbacks receive the entity index as their first argument after the context,
+     * so a callback written for a plain `signal<unsigned int, arguments...>` can be connected
+     * unchanged. Each entity's subscribers run in the order they were connected.
+     *
+     * Connections made since the last dispatch are sorted in lazily by a stable counting sort
+     * over all connections, run by the next `fire()` or `fire_all()`. Connections made while
+     * the array is firing are first invoked by the next dispatch. Disconnected connections
+     * are skipped and dropped from the packed storage by the next sort.
+     *
+     * Storage for the number of entities and connections chosen at construction is obtained
+     * in a single block from an `arena_allocator`.
+     *
+     * @tparam arguments The argument types forwarded to each callback after the entity index.
+     */
+    template<typename... arguments>
+    class signal_array {
+    public:
+        /**
+         * @brief Constructs a signal array for `entity_count` entities and up to `connection_capacity` connections.
+         * @since 1.2.0
+         *
+         * If the allocator returns no memory, the array has no entities and refuses every connection.
+         *
+         * @param entity_count Number of logical signals, addressed by index `0` to `entity_count - 1`.
+         * @param connection_capacity Maximum number of connections across all entities.
+         * @param source Allocator providing the storage. Defaults to `default_allocator()`.
+         */
+        signal_array(unsigned int entity_count, unsigned int connection_capacity,
+                     const arena_allocator& source = default_allocator())
+            : allocator(source), block(nullptr), bytes(0), entities(0), capacity(0), touched(0), available(0),
+              total(0), pending_count(0), firing(0), active(true) {
+            detail::size_type size = 0;
+            detail::size_type node_offset = detail::reserve<connection<unsigned int, arguments...>>(size, connection_capacity);
+            detail::size_type callback_offset =
+                detail::reserve<void (*)(void*, unsigned int, arguments...)>(size, connection_capacity);
+            detail::size_type context_offset = detail::reserve<void*>(size, connection_capacity);
+            detail::size_type entity_offset = detail::reserve<unsigned int>(size, connection_capacity);
+            detail::size_type sorted_offset = detail::reserve<unsigned int>(size, connection_capacity);
+            detail::size_type node_entity_offset = detail::reserve<unsigned int>(size, connection_capacity);
+            detail::size_type pending_offset = detail::reserve<unsigned int>(size, connection_capacity);
+            detail::size_type vacant_offset = detail::reserve<unsigned int>(size, connection_capacity);
+            detail::size_type offsets_offset = detail::reserve<unsigned int>(size, entity_count + 1);
+
+            unsigned char* memory = static_cast<unsigned char*>(allocator.allocate(size, allocator.user));
+            if (!memory) {
+                return;
+            }
+
+            block = memory;
+            bytes = size;
+            entities = entity_count;
+            capacity = connection_capacity;
+            nodes = reinterpret_cast<connection<unsigned int, arguments...>*>(memory + node_offset);
+            callbacks = reinterpret_cast<void (**)(void*, unsigned int, arguments...)>(memory + callback_offset);
+            contexts = reinterpret_cast<void**>(memory + context_offset);
+            sorted_entities = reinterpret_cast<unsigned int*>(memory + entity_offset);
+            sorted_nodes = reinterpret_cast<unsigned int*>(memory + sorted_offset);
+            node_entity = reinterpret_cast<unsigned int*>(memory + node_entity_offset);
+            pending = reinterpret_cast<unsigned int*>(memory + pending_offset);
+            vacant = reinterpret_cast<unsigned int*>(memory + vacant_offset);
+            offsets = reinterpret_cast<unsigned int*>(memory + offsets_offset);
+
+            for (unsigned int i = 0; i <= entity_count; ++i) {
+                offsets[i] = 0;
+            }
+        }
+
+        signal_array(const signal_array&) = delete;
+        signal_array& operator=(const signal_array&) = delete;
+
+        /**
+         * @brief Disconnects every subscriber and returns the storage to the allocator.
+         * @since 1.2.0
+         */
+        ~signal_array() {
+            disconnect_all();
+            if (block) {
+                allocator.release(block, bytes, allocator.user);
+            }
+        }
+
+        /**
+         * @brief Registers a persistent callback for one entity.
+         * @since 1.2.0
+         *
+         * @param entity Index of the entity to listen to.
+         * @param function Pointer to the callback function to invoke when the entity's signal fires.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if the entity is out of range or the array is full.
+         */
+        connection<unsigned int, arguments...>* connect(unsigned int entity, void (*function)(void* context, unsigned int, arguments...), void* context) {
+            return attach(entity, function, context, false);
+        }
+
+        /**
+         * @brief Registers a one-shot callback for one entity.
+         * @since 1.2.0
+         *
+         * @param entity Index of the entity to listen to.
+         * @param function Pointer to the callback function to invoke once.
+         * @param context User-defined pointer passed to the callback when invoked.
+         * @return Pointer to the new connection, or nullptr if the entity is out of range or the array is full.
+         */
+        connection<unsigned int, arguments...>* once(unsigned int entity, void (*function)(void* context, unsigned int, arguments...), void* context) {
+            return attach(entity, function, context, true);
+        }
+
+        /**
+         * @brief Disconnects every subscriber of every entity.
+         * @since 1.2.0
+         */
+        void disconnect_all() {
+            for (unsigned int i = 0; i < touched; ++i) {
+                nodes[i].disconnect();
+            }
+        }
+
+        /**
+         * @brief Disconnects every subscriber of one entity.
+         * @since 1.2.0
+         *
+         * @param entity Index of the entity whose subscribers are disconnected.
+         */
+        void disconnect_entity(unsigned int entity) {
+            for (unsigned int i = 0; i < touched; ++i) {
+                if (node_entity[i] == entity) {
+                    nodes[i].disconnect();
+                }
+            }
+        }
+
+        /**
+         * @brief Disconnects every subscriber whose user context pointer matches the given pointer.
+         * @since 1.2.0
+         *
+         * @param context The user-defined context pointer to match and disconnect.
+         */
+        void disconnect_by_context(void* context) {
+            for (unsigned int i = 0; i < touched; ++i) {
+                if (nodes[i].connected && nodes[i].context == context) {
+                    nodes[i].disconnect();
+                }
+            }
+        }
+
+        /**
+         * @brief Suspends the array, so neither `fire()` nor `fire_all()` invoke callbacks.
+         * @since 1.2.0
+         */
+        void suspend() {
+            active = false;
+        }
+
+        /**
+         * @brief Resumes dispatch after `suspend()`.
+         * @since 1.2.0
+         */
+        void resume() {
+            active = true;
+        }
+
+        /**
+         * @brief Fires the signal of one entity, invoking its subscribers with the given arguments.
+         * @since 1.2.0
+         *
+         * @param entity Index of the entity whose signal fires; out of range indices are ignored.
+         * @param args The argument pack forwarded to each callback after the entity index.
+         */
+        void fire(unsigned int entity, arguments... args) {
+            if (!active || entity >= entities) {
+                return;
+            }
+
+            prepare();
+            dispatch(offsets[entity], offsets[entity + 1], args...);
+        }
+
+        /**
+         * @brief Fires the signal of every entity in one pass over the packed storage.
+         * @since 1.2.0
+         *
+         * Entities are visited in index order, each with its subscribers in connection order,
+         * exactly as if `fire()` was called for every entity in turn.
+         *
+         * @param args The argument pack forwarded to each callback after the entity index.
+         */
+        void fire_all(arguments... args) {
+            if (!active) {
+                return;
+            }
+
+            prepare();
+            dispatch(0, total, args...);
+        }
+
+        /**
+         * @brief Returns the number of entities.
+         * @since 1.2.0
+         */
+        unsigned int entity_count() const {
+            return entities;
+        }
+
+        /**
+         * @brief Returns the maximum number of connections across all entities.
+         * @since 1.2.0
+         */
+        unsigned int max_connections() const {
+            return capacity;
+        }
+
+        /**
+         * @brief Returns the number of currently connected subscribers across all entities.
+         * @since 1.2.0
+         */
+        unsigned int connection_count() const {
+            unsigned int count = 0;
+
+            for (unsigned int i = 0; i < touched; ++i) {
+                if (nodes[i].connected) {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+    private:
+        connection<unsigned int, arguments...>* attach(unsigned int entity, void (*function)(void*, unsigned int, arguments...), void* context, bool once) {
+            if (entity >= entities) {
+                return nullptr;
+            }
+            if (available == 0 && touched == capacity && firing == 0) {
+                sort();
+            }
+
+            unsigned int node;
+            if (available > 0) {
+                node = vacant[--available];
+            } else if (touched < capacity) {
+                node = touched++;
+            } else {
+                return nullptr;
+            }
+
+            connection<unsigned int, arguments...>& added = nodes[node];
+            added.connected = true;
+            added.once = once;
+            added.callback = function;
+            added.context = context;
+            added.priority = 0;
+            added.owner = nullptr;
+            added.links = nullptr;
+            node_entity[node] = entity;
+            pending[pending_count++] = node;
+            return &added;
+        }
+
+        /**
+         * @brief Sorts pending connections into the packed storage before a dispatch.
+         * @since 1.2.0
+         *
+         * Skipped while a dispatch is running, so the ranges it walks stay put.
+         */
+        void prepare() {
+            if (pending_count > 0 && firing == 0) {
+                sort();
+            }
+        }
+
+        /**
+         * @brief Rebuilds the packed storage with a stable counting sort by entity.
+         * @since 1.2.0
+         *
+         * The live connections already in the packed storage come first and the pending ones
+         * after them in connection order, so each entity keeps its subscribers in the order
+         * they were connected. Disconnected connections are dropped and their nodes recycled.
+         * The pending list doubles as scratch space for the sort input.
+         */
+        void sort() {
+            for (unsigned int e = 0; e <= entities; ++e) {
+                offsets[e] = 0;
+            }
+
+            unsigned int kept_pending = 0;
+            for (unsigned int i = 0; i < pending_count; ++i) {
+                unsigned int node = pending[i];
+                if (nodes[node].connected) {
+                    offsets[node_entity[node] + 1]++;
+                    pending[kept_pending++] = node;
+                } else {
+                    vacant[available++] = node;
+                }
+            }
+
+            unsigned int kept_sorted = 0;
+            for (unsigned int p = 0; p < total; ++p) {
+                unsigned int node = sorted_nodes[p];
+                if (nodes[node].connected) {
+                    offsets[node_entity[node] + 1]++;
+                    kept_sorted++;
+                } else {
+                    vacant[available++] = node;
+                }
+            }
+
+            for (unsigned int i = kept_pending; i > 0; --i) {
+                pending[kept_sorted + i - 1] = pending[i - 1];
+            }
+            for (unsigned int p = 0, i = 0; p < total; ++p) {
+                if (nodes[sorted_nodes[p]].connected) {
+                    pending[i++] = sorted_nodes[p];
+                }
+            }
+
+            for (unsigned int e = 0; e < entities; ++e) {
+                offsets[e + 1] += offsets[e];
+            }
+
+            unsigned int count = kept_sorted + kept_pending;
+            for (unsigned int i = 0; i < count; ++i) {
+                unsigned int node = pending[i];
+                unsigned int entity = node_entity[node];
+                unsigned int p = offsets[entity]++;
+                sorted_nodes[p] = node;
+                sorted_entities[p] = entity;
+                callbacks[p] = nodes[node].callback;
+                contexts[p] = nodes[node].context;
+            }
+
+            for (unsigned int e = entities; e > 0; --e) {
+                offsets[e] = offsets[e - 1];
+            }
+            offsets[0] = 0;
+
+            total = count;
+            pending_count = 0;
+        }
+
+        /**
+         * @brief Invokes the live subscribers in the packed range `[begin, end)`.
+         * @since 1.2.0
+         */
+        void dispatch(unsigned int begin, unsigned int end, arguments... args) {
+            firing++;
+
+            for (unsigned int p = begin; p < end; ++p) {
+                connection<unsigned int, arguments...>& current = nodes[sorted_nodes[p]];
+                if (current.connected && callbacks[p] && !current.muted()) {
+                    callbacks[p](contexts[p], sorted_entities[p], args...);
+
+                    if (current.once) {
+                        current.disconnect();
+                    }
+                }
+            }
+
+            firing--;
+        }
+
+        /**
+         * @brief Allocator that provided `block`, which holds all arrays below, and its size.
+         * @since 1.2.0
+         */
+        arena_allocator allocator;
+        unsigned char* block;
+        detail::size_type bytes;
+
+        /**
+         * @brief Connection handles, indexed by node. Handles never move.
+         * @since 1.2.0
+         */
+        connection<unsigned int, arguments...>* nodes;
+
+        /**
+         * @brief Packed callbacks, contexts, entity indices and node indices, sorted by entity.
+         * @since 1.2.0
+         *
+         * Entity `e` owns the packed range `[offsets[e], offsets[e + 1])`.
+         */
+        void (**callbacks)(void*, unsigned int, arguments...);
+        void** contexts;
+        unsigned int* sorted_entities;
+        unsigned int* sorted_nodes;
+        unsigned int* offsets;
+
+        /**
+         * @brief Entity index of each node.
+         * @since 1.2.0
+         */
+        unsigned int* node_entity;
+
+        /**
+         * @brief Nodes connected since the last sort, in connection order.
+         * @since 1.2.0
+         */
+        unsigned int* pending;
+
+        /**
+         * @brief Stack of recycled nodes.
+         * @since 1.2.0
+         */
+        unsigned int* vacant;
+
+        /**
+         * @brief Number of entities and maximum number of connections.
+         * @since 1.2.0
+         */
+        unsigned int entities;
+        unsigned int capacity;
+
+        /**
+         * @brief Number of nodes handed out at least once; nodes at and beyond it were never used.
+         * @since 1.2.0
+         */
+        unsigned int touched;
+
+        /**
+         * @brief Number of entries in `vacant`, in the packed storage and in `pending`.
+         * @since 1.2.0
+         */
+        unsigned int available;
+        unsigned int total;
+        unsigned int pending_count;
+
+        /**
+         * @brief Nesting depth of dispatches; the packed storage is not rebuilt while it is non-zero.
+         * @since 1.2.0
+         */
+        unsigned int firing;
+
+        /**
+         * @brief Whether `fire()` and `fire_all()` currently dispatch callbacks.
+         * @since 1.2.0
+         */
+        bool active;
+    };
+
+    /**
+     * @brief Mix-in that disconnects the connections of an object when it is destroyed.
+     * @since 1.2.0
+     *
+     * Deriving a context type from `trackable` and passing the connections made with it to
+     * `track()` records them in an intrusive list threaded through the connections' link records.
+     * The destructor disconnects exactly those connections, in time proportional to their
+     * number, so a destroyed object can never be called back, and there is no need to run
+     * `disconnect_by_context()` over every signal it might have joined.
+     *
+     * A connection leaves the list as soon as it is disconnected by any means, including
+     * one-shot expiry and the destruction of its signal, so the list only ever holds live
+     * connections. Connections of any signal type can be tracked by the same object.
+     * Moving a signal keeps its connections tracked, and copying one tracks the copies too.
+     *
+     * Copying a trackable does not copy its tracked connections.
+     */
+    class trackable {
+    public:
+        /**
+         * @brief Constructs a trackable that tracks no connections.
+         * @since 1.2.0
+         */
+        trackable() {}
+
+        /**
+         * @brief Constructs a trackable that tracks no connections; the other's connections stay with it.
+         * @since 1.2.0
+         */
+        trackable(const trackable&) {}
+
+        /**
+         * @brief Keeps this trackable's own connections; the other's connections stay with it.
+         * @since 1.2.0
+         */
+        trackable& operator=(const trackable&) {
+            return *this;
+        }
+
+        /**
+         * @brief Disconnects every tracked connection.
+         * @since 1.2.0
+         */
+        ~trackable() {
+            disconnect_tracked();
+        }
+
+        /**
+         * @brief Tracks a connection, so it is disconnected when this object is destroyed.
+         * @since 1.2.0
+         *
+         * A connection tracked by another trackable moves to this one.
+         * Null and already disconnected connections are ignored.
+         *
+         * Tracking takes a record from `detail::link_pool`, unless the connection already holds one.
+         *
+         * @param handle The connection to track, typically the result of `connect()` or `once()`.
+         * @return `handle`, so the call can wrap `connect()` directly.
+         */
+        template<typename... arguments>
+        connection<arguments...>* track(connection<arguments...>* handle) {
+            if (handle && handle->connected) {
+                handle->acquire_links();
+                tracked.push(handle->links->tracking, handle, &connection<arguments...>::sever);
+            }
+            return handle;
+        }
+
+        /**
+         * @brief Stops tracking a connection without disconnecting it.
+         * @since 1.2.0
+         *
+         * @param handle The connection to stop tracking; it must be tracked by this object or by none.
+         */
+        template<typename... arguments>
+        void untrack(connection<arguments...>* handle) {
+            if (handle && handle->connected && handle->links && handle->links->tracking.previous) {
+                detail::unlink(handle->links->tracking);
+            }
+        }
+
+        /**
+         * @brief Disconnects every tracked connection now.
+         * @since 1.2.0
+         */
+        void disconnect_tracked() {
+            tracked.sever_all();
+        }
+
+        /**
+         * @brief Returns the number of tracked connections.
+         * @since 1.2.0
+         */
+        unsigned int tracked_count() const {
+            return tracked.size();
+        }
+
+    private:
+        /**
+         * @brief The tracked connections.
+         * @since 1.2.0
+         */
+        detail::link_list tracked;
+    };
+
+    /**
+     * @brief A set of connections, possibly across many signals, that are managed together.
+     * @since 1.2.0
+     *
+     * A subsystem wired into many signals adds each of its connections to one group,
+     * and can later tear all of them down with `disconnect_all()`, in time proportional
+     * to the size of the group instead of one full scan per signal. Members are kept in an
+     * intrusive list threaded through the connections' link records, and leave it as soon
+     * as they are disconnected by any means.
+     *
+     * `suspend()` mutes every member at once: each connection points at the group's flag,
+     * so dispatch checks a single flag per member and `suspend()`/`resume()` cost O(1).
+     *
+     * Moving a signal keeps its connections in their groups, and copying one adds the copies
+     * to the groups of the originals. Destroying a group disconnects its members.
+     */
+    class connection_group {
+    public:
+        /**
+         * @brief Constructs an empty, active group.
+         * @since 1.2.0
+         */
+        connection_group() : active(true) {}
+
+        connection_group(const connection_group&) = delete;
+        connection_group& operator=(const connection_group&) = delete;
+
+        /**
+         * @brief Disconnects every member.
+         * @since 1.2.0
+         */
+        ~connection_group() {
+            disconnect_all();
+        }
+
+        /**
+         * @brief Adds a connection to the group.
+         * @since 1.2.0
+         *
+         * A connection that belongs to another group moves to this one.
+         * Null and already disconnected connections are ignored.
+         *
+         * Membership takes a record from `detail::link_pool`, unless the connection already holds one.
+         *
+         * @param handle The connection to add, typically the result of `connect()` or `once()`.
+         * @return `handle`, so the call can wrap `connect()` directly.
+         */
+        template<typename... arguments>
+        connection<arguments...>* add(connection<arguments...>* handle) {
+            if (handle && handle->connected) {
+                handle->acquire_links();
+                members.push(handle->links->grouping, handle, &connection<arguments...>::sever);
+                set_gate(handle, &active);
+            }
+            return handle;
+        }
+
+        /**
+         * @brief Removes a connection from the group without disconnecting it.
+         * @since 1.2.0
+         *
+         * @param handle The connection to remove; it must belong to this group or to none.
+         */
+        template<typename... arguments>
+        void remove(connection<arguments...>* handle) {
+            if (handle && handle->connected && handle->links && handle->links->grouping.previous) {
+                detail::unlink(handle->links->grouping);
+                set_gate(handle, nullptr);
+            }
+        }
+
+        /**
+         * @brief Disconnects every member of the group.
+         * @since 1.2.0
+         */
+        void disconnect_all() {
+            members.sever_all();
+        }
+
+        /**
+         * @brief Mutes every member until `resume()` is called; members stay connected.
+         * @since 1.2.0
+         */
+        void suspend() {
+            active = false;
+        }
+
+        /**
+         * @brief Lets the members run again after `suspend()`.
+         * @since 1.2.0
+         */
+        void resume() {
+            active = true;
+        }
+
+        /**
+         * @brief Returns whether the group is suspended.
+         * @since 1.2.0
+         */
+        bool suspended() const {
+            return !active;
+        }
+
+        /**
+         * @brief Returns the number of connections in the group.
+         * @since 1.2.0
+         */
+        unsigned int size() const {
+            return members.size();
+        }
+
+    private:
+        template<typename... arguments>
+        static void set_gate(connection<arguments...>* handle, const bool* gate) {
+            if (handle->owner) {
+                handle->owner->regate(handle, gate);
+            } else {
+                handle->links->gate = gate;
+            }
+        }
+
+        /**
+         * @brief Flag every member's `gate` points at.
+         * @since 1.2.0
+         */
+        bool active;
+
+        /**
+         * @brief The member connections.
+         * @since 1.2.0
+         */
+        detail::link_list members;
+    };
 }
 
 #endif // !CPP_CONNECTIONS_HEADER_GUARD